@@ -14,6 +14,13 @@ public class ListParent : MonoBehaviour
     [SerializeField]
     private TrackingAssembly     assembly;
 
+    // Requires a tracking backend, which reports every part with its own
+    // name, and a VLTrackedObjectBehaviour per part using the part name
+    [SerializeField]
+    [Tooltip("Recognize all parts at the same time instead of one after another.")]
+    private bool recognizeInParallel = false;
+    private bool parallelRecognitionStarted = false;
+
     public void addComponent(ListComponent listComponent)
     {
         components.Add(listComponent);
@@ -21,6 +28,10 @@ public class ListParent : MonoBehaviour
 
     public void changeSelection(ListComponent selected)
     {
+        // All parts stay selected while they are recognized in parallel
+        if (recognizeInParallel)
+            return;
+
         if (activeComponent != null)
             activeComponent.SetState(false);
         activeComponent = selected;
@@ -39,6 +50,18 @@ public class ListParent : MonoBehaviour
 
     public void recognizeNext()
     {
+        if (recognizeInParallel)
+        {
+            // The other parts are still being recognized
+            foreach (ListComponent x in components)
+            {
+                if (!x.GetRecognized())
+                    return;
+            }
+            changeSelection(assembly);
+            return;
+        }
+
         foreach (ListComponent x in components)
         {
             if (!x.GetRecognized())
@@ -51,8 +74,27 @@ public class ListParent : MonoBehaviour
         changeSelection(assembly);
     }
 
+    private void selectAll()
+    {
+        activeComponent = null;
+        foreach (ListComponent x in components)
+        {
+            x.SetState(true);
+        }
+    }
+
     private void Start()
     {
         gameObject.GetComponent<StartTrackingWithCameraSelectionBehaviour>().StartTracking(vlFile);
     }
+
+    private void Update()
+    {
+        // The components register themselves in their Start
+        if (recognizeInParallel && !parallelRecognitionStarted)
+        {
+            parallelRecognitionStarted = true;
+            selectAll();
+        }
+    }
 }
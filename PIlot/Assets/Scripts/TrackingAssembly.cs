@@ -8,30 +8,33 @@ public class TrackingAssembly : MonoBehaviour
     [SerializeField]
     private int TARGET = 30;
 
-    private string state;
+    private VLTrackingStateInfo.State state;
     private int counter = 0;
 
     private SceneChanger sceneChanger;
     [SerializeField]
     private int scene;
 
+    private VLTrackedObjectBehaviour trackedObject;
+
     private void Start()
     {
         sceneChanger = GetComponent<SceneChanger>();
+        trackedObject = GetComponent<VLTrackedObjectBehaviour>();
     }
 
     void FixedUpdate()
     {
-        state = gameObject.GetComponent<VLTrackedObjectBehaviour>().previousState;
+        state = trackedObject.GetTrackingState();
 
         switch (state)
         {
-            case "tracked":
+            case VLTrackingStateInfo.State.Tracked:
                 counter++;
                 break;
-            case "critical":
+            case VLTrackingStateInfo.State.Critical:
                 break;
-            case "lost":
+            case VLTrackingStateInfo.State.Lost:
                 counter = 0;
                 break;
             default:
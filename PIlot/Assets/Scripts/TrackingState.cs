@@ -8,24 +8,31 @@ public class TrackingState : MonoBehaviour
     [SerializeField]
     private int TARGET = 30;
 
-    private string state;
+    private VLTrackingStateInfo.State state;
     private int counter = 0;
 
     [SerializeField]
     private ListComponent listComponent;
 
+    private VLTrackedObjectBehaviour trackedObject;
+
+    private void Start()
+    {
+        trackedObject = GetComponent<VLTrackedObjectBehaviour>();
+    }
+
     void FixedUpdate()
     {
-        state = gameObject.GetComponent<VLTrackedObjectBehaviour>().previousState;
+        state = trackedObject.GetTrackingState();
 
         switch (state)
         {
-            case "tracked":
+            case VLTrackingStateInfo.State.Tracked:
                 counter++;
                 break;
-            case "critical":
+            case VLTrackingStateInfo.State.Critical:
                 break;
-            case "lost":
+            case VLTrackingStateInfo.State.Lost:
                 counter = 0;
                 break;
             default:
@@ -0,0 +1,195 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+using System.Collections.Generic;
+
+/// <summary>
+///  Event which delivers its values according to the
+///  <see cref="VLDeliveryPolicy"/> of each listener.
+/// </summary>
+/// <remarks>
+///  <para>
+///   Listeners with <see cref="VLDeliveryPolicy.Mode.All"/> and
+///   <see cref="VLDeliveryPolicy.Mode.EveryNth"/> are notified directly from
+///   <see cref="Dispatch"/>. For listeners with
+///   <see cref="VLDeliveryPolicy.Mode.LatestOnly"/> the newest value is kept
+///   (using the retain function) and delivered by <see cref="Flush"/>.
+///   Replaced values are released without being delivered.
+///  </para>
+///  <para>
+///   Values are only retained, if a LatestOnly listener exists. Skipped
+///   values of EveryNth listeners are never retained.
+///  </para>
+/// </remarks>
+/// <typeparam name="T">Type of the event values.</typeparam>
+public class VLCoalescingEvent<T> where T : class
+{
+    private class Listener
+    {
+        public Delegate key;
+        public Action<T> action;
+        public VLDeliveryPolicy policy;
+        public int skipped;
+    }
+
+    private List<Listener> listeners = new List<Listener>();
+    // Copy of the listeners, which can be iterated while listeners are
+    // added or removed from within a callback
+    private Listener[] listenerArray = new Listener[0];
+    private Func<T, T> retain;
+    private Action<T> release;
+    private T latest = null;
+    private long replacedCount = 0;
+
+    /// <summary>
+    ///  Constructor of VLCoalescingEvent.
+    /// </summary>
+    /// <param name="retain">
+    ///  Returns a value, which stays valid after the dispatch.
+    /// </param>
+    /// <param name="release">
+    ///  Releases a value returned by the retain function.
+    /// </param>
+    public VLCoalescingEvent(Func<T, T> retain, Action<T> release)
+    {
+        this.retain = retain;
+        this.release = release;
+    }
+
+    /// <summary>
+    ///  Adds a listener.
+    /// </summary>
+    /// <param name="key">Delegate identifying the listener.</param>
+    /// <param name="action">Action invoked with the event values.</param>
+    /// <param name="policy">Delivery policy of the listener.</param>
+    public void Add(Delegate key, Action<T> action, VLDeliveryPolicy policy)
+    {
+        Listener listener = new Listener();
+        listener.key = key;
+        listener.action = action;
+        listener.policy = policy;
+        this.listeners.Add(listener);
+        this.listenerArray = this.listeners.ToArray();
+    }
+
+    /// <summary>
+    ///  Removes a listener.
+    /// </summary>
+    /// <param name="key">Delegate identifying the listener.</param>
+    public void Remove(Delegate key)
+    {
+        int index = this.listeners.FindIndex(l => l.key.Equals(key));
+        if (index < 0)
+        {
+            return;
+        }
+
+        this.listeners.RemoveAt(index);
+        this.listenerArray = this.listeners.ToArray();
+    }
+
+    /// <summary>
+    ///  Returns whether listeners are registered.
+    /// </summary>
+    public bool HasListeners()
+    {
+        return this.listenerArray.Length > 0;
+    }
+
+    /// <summary>
+    ///  Notifies the listeners about a new value.
+    /// </summary>
+    /// <param name="value">
+    ///  Value, which is only valid during this call.
+    /// </param>
+    public void Dispatch(T value)
+    {
+        bool keepLatest = false;
+        Listener[] currentListeners = this.listenerArray;
+        for (int i = 0; i < currentListeners.Length; ++i)
+        {
+            Listener listener = currentListeners[i];
+            switch (listener.policy.mode)
+            {
+                case VLDeliveryPolicy.Mode.All:
+                    listener.action(value);
+                    break;
+                case VLDeliveryPolicy.Mode.EveryNth:
+                    if (++listener.skipped >= listener.policy.interval)
+                    {
+                        listener.skipped = 0;
+                        listener.action(value);
+                    }
+                    break;
+                case VLDeliveryPolicy.Mode.LatestOnly:
+                    keepLatest = true;
+                    break;
+            }
+        }
+
+        if (keepLatest)
+        {
+            if (this.latest != null)
+            {
+                ++this.replacedCount;
+            }
+            Clear();
+            this.latest = this.retain(value);
+        }
+    }
+
+    /// <summary>
+    ///  Returns the number of values, which were replaced by a newer value
+    ///  before they could be delivered to the LatestOnly listeners.
+    /// </summary>
+    public long GetReplacedCount()
+    {
+        return this.replacedCount;
+    }
+
+    /// <summary>
+    ///  Delivers the newest value to the LatestOnly listeners.
+    /// </summary>
+    public void Flush()
+    {
+        T value = this.latest;
+        if (value == null)
+        {
+            return;
+        }
+        this.latest = null;
+
+        try
+        {
+            Listener[] currentListeners = this.listenerArray;
+            for (int i = 0; i < currentListeners.Length; ++i)
+            {
+                if (currentListeners[i].policy.mode ==
+                    VLDeliveryPolicy.Mode.LatestOnly)
+                {
+                    currentListeners[i].action(value);
+                }
+            }
+        }
+        finally
+        {
+            this.release(value);
+        }
+    }
+
+    /// <summary>
+    ///  Releases the newest value without delivering it.
+    /// </summary>
+    public void Clear()
+    {
+        if (this.latest != null)
+        {
+            this.release(this.latest);
+            this.latest = null;
+        }
+    }
+}
+
+/**@}*/
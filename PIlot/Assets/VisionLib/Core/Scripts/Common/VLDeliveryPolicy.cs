@@ -0,0 +1,66 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+
+/// <summary>
+///  Defines which events a listener of the VLWorkerBehaviour receives.
+/// </summary>
+/// <seealso cref="VLWorkerBehaviour.AddImageListener"/>
+public class VLDeliveryPolicy
+{
+    /// <summary>
+    ///  Delivery modes.
+    /// </summary>
+    public enum Mode
+    {
+        /// <summary>Every event will be delivered.</summary>
+        All,
+        /// <summary>
+        ///  Only the newest event of each Update will be delivered. Older
+        ///  events are dropped.
+        /// </summary>
+        LatestOnly,
+        /// <summary>Only every n-th event will be delivered.</summary>
+        EveryNth
+    };
+
+    /// <summary>Policy, which delivers every event.</summary>
+    public static readonly VLDeliveryPolicy All =
+        new VLDeliveryPolicy(Mode.All, 1);
+
+    /// <summary>Policy, which only delivers the newest event.</summary>
+    public static readonly VLDeliveryPolicy LatestOnly =
+        new VLDeliveryPolicy(Mode.LatestOnly, 1);
+
+    /// <summary>Delivery mode.</summary>
+    public readonly Mode mode;
+
+    /// <summary>
+    ///  Number of events per delivered event for <see cref="Mode.EveryNth"/>.
+    /// </summary>
+    public readonly int interval;
+
+    private VLDeliveryPolicy(Mode mode, int interval)
+    {
+        this.mode = mode;
+        this.interval = interval;
+    }
+
+    /// <summary>
+    ///  Creates a policy, which only delivers every n-th event.
+    /// </summary>
+    /// <param name="n">Number of events per delivered event.</param>
+    public static VLDeliveryPolicy EveryNth(int n)
+    {
+        if (n < 1)
+        {
+            throw new ArgumentOutOfRangeException("n");
+        }
+
+        return new VLDeliveryPolicy(Mode.EveryNth, n);
+    }
+}
+
+/**@}*/
@@ -0,0 +1,195 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+using System.Diagnostics;
+
+/// <summary>
+///  Assigns frame indices and monotonic timestamps to the events received
+///  from the VisionLib worker.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The VisionLib delivers the image, the extrinsic data, the intrinsic
+///   data and the tracking state of a frame through separate listeners in
+///   this order, followed by the performance info. The tracking state
+///   completes a frame, so the next event other than the performance info
+///   starts a new frame. This also separates frames, which lack an event
+///   kind (e.g. a frame without an image). Without tracking states a new
+///   frame starts as soon as an event kind arrives, which was already
+///   received for the current frame. All events of one frame therefore
+///   share the same frame index and timestamp.
+///  </para>
+///  <para>
+///   The timestamp of a frame is the capture time of its image as reported
+///   by the VisionLib in <see cref="VLTrackingState.TrackingObject.timeStamp"/>.
+///   It is converted into seconds of the monotonic clock of
+///   <see cref="GetTime"/>. The tracking states arrive after the image and
+///   the extrinsic data of a frame. Until then the capture time is
+///   estimated from the arrival time and the latency of the previous frame
+///   (see <see cref="HasCaptureTime"/>).
+///  </para>
+///  <para>
+///   The time, at which the first event of a frame arrived in Unity, is
+///   available separately as <see cref="GetFrameArrivalTime"/>.
+///  </para>
+/// </remarks>
+public class VLFrameClock
+{
+    /// <summary>
+    ///  Kinds of events belonging to a frame.
+    /// </summary>
+    public enum EventKind
+    {
+        /// <summary>Camera image.</summary>
+        Image = 0,
+        /// <summary>Extrinsic camera parameters.</summary>
+        ExtrinsicData = 1,
+        /// <summary>Intrinsic camera parameters.</summary>
+        IntrinsicData = 2,
+        /// <summary>Tracking states of the tracked objects.</summary>
+        TrackingStates = 3,
+        /// <summary>Performance information.</summary>
+        PerformanceInfo = 4
+    };
+
+    private static readonly double secondsPerTick =
+        1.0 / Stopwatch.Frequency;
+
+    private static readonly DateTime unixEpoch =
+        new DateTime(1970, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+
+    private int receivedEvents = 0;
+    private bool frameComplete = false;
+    private long frameIndex = -1;
+    private double frameTimestamp = 0.0;
+    private double frameArrivalTime = 0.0;
+    private bool captureTimeReceived = false;
+    // Time between the capture and the arrival of the last frame with a
+    // capture time. Negative, if no capture time was received yet.
+    private double captureLatency = -1.0;
+
+    /// <summary>
+    ///  Returns the current time of the monotonic clock in seconds.
+    /// </summary>
+    public static double GetTime()
+    {
+        return Stopwatch.GetTimestamp() * secondsPerTick;
+    }
+
+    /// <summary>
+    ///  Registers an event and starts a new frame, if the tracking state or
+    ///  an event of the same kind was already received for the current
+    ///  frame.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if the event started a new frame;
+    ///  <c>false</c> otherwise.
+    /// </returns>
+    /// <param name="kind">Kind of the received event.</param>
+    public bool OnEvent(EventKind kind)
+    {
+        int eventBit = 1 << (int)kind;
+        bool newFrame =
+            (this.frameIndex < 0 || (this.receivedEvents & eventBit) != 0 ||
+             (this.frameComplete && kind != EventKind.PerformanceInfo));
+        if (newFrame)
+        {
+            ++this.frameIndex;
+            this.frameArrivalTime = GetTime();
+            this.frameTimestamp = this.frameArrivalTime -
+                Math.Max(this.captureLatency, 0.0);
+            this.captureTimeReceived = false;
+            this.receivedEvents = 0;
+            this.frameComplete = false;
+        }
+        this.receivedEvents |= eventBit;
+        if (kind == EventKind.TrackingStates)
+        {
+            this.frameComplete = true;
+        }
+
+        return newFrame;
+    }
+
+    /// <summary>
+    ///  Sets the capture time of the current frame reported by the
+    ///  VisionLib.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if the capture time was valid; <c>false</c> otherwise.
+    /// </returns>
+    /// <param name="timeStamp">
+    ///  Capture time in seconds since 1.1.1970 (see
+    ///  <see cref="VLTrackingState.TrackingObject.timeStamp"/>).
+    /// </param>
+    public bool SetCaptureTime(double timeStamp)
+    {
+        if (this.frameIndex < 0 || timeStamp <= 0.0)
+        {
+            return false;
+        }
+
+        // The VisionLib uses the wall clock. The age of the image is the
+        // same on both clocks.
+        double now = GetTime();
+        double age = (DateTime.UtcNow - unixEpoch).TotalSeconds - timeStamp;
+        double captureTime = now - age;
+
+        // Reject timestamps of another clock, e.g. of a recorded sequence
+        if (age < 0.0 || captureTime > this.frameArrivalTime)
+        {
+            return false;
+        }
+
+        this.frameTimestamp = captureTime;
+        this.captureTimeReceived = true;
+        this.captureLatency = this.frameArrivalTime - captureTime;
+        return true;
+    }
+
+    /// <summary>
+    ///  Returns whether the timestamp of the current frame is the capture
+    ///  time reported by the VisionLib.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if the capture time was received;
+    ///  <c>false</c>, if the timestamp is estimated.
+    /// </returns>
+    public bool HasCaptureTime()
+    {
+        return this.captureTimeReceived;
+    }
+
+    /// <summary>
+    ///  Returns the index of the current frame.
+    /// </summary>
+    /// <returns>
+    ///  Index of the current frame or -1, if no event was received yet.
+    /// </returns>
+    public long GetFrameIndex()
+    {
+        return this.frameIndex;
+    }
+
+    /// <summary>
+    ///  Returns the capture time of the current frame in seconds of the
+    ///  monotonic clock.
+    /// </summary>
+    public double GetFrameTimestamp()
+    {
+        return this.frameTimestamp;
+    }
+
+    /// <summary>
+    ///  Returns the time in seconds of the monotonic clock, at which the
+    ///  first event of the current frame arrived.
+    /// </summary>
+    public double GetFrameArrivalTime()
+    {
+        return this.frameArrivalTime;
+    }
+}
+
+/**@}*/
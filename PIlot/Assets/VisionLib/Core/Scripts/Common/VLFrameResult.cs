@@ -0,0 +1,103 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+
+/// <summary>
+///  VLFrameResult bundles all results of one tracking frame.
+/// </summary>
+/// <remarks>
+///  <para>
+///   All members are detached from the native objects and belong to the
+///   same frame. Members, which weren't delivered for the frame, are
+///   <c>null</c>.
+///  </para>
+///  <para>
+///   The VLFrameResult will be disposed after the
+///   <see cref="VLWorkerBehaviour.OnFrameResult"/> event. Call
+///   <see cref="VLImageWrapper.Retain"/> on the image in order to use it
+///   afterwards.
+///  </para>
+/// </remarks>
+public class VLFrameResult: IDisposable
+{
+    /// <summary>Index of the frame.</summary>
+    /// <seealso cref="VLFrameClock"/>
+    public long frameIndex;
+
+    /// <summary>
+    ///  Capture time of the frame in seconds of the monotonic clock.
+    /// </summary>
+    /// <seealso cref="VLFrameClock.GetFrameTimestamp"/>
+    public double frameTimestamp;
+
+    /// <summary>
+    ///  Time in seconds of the monotonic clock, at which the frame arrived
+    ///  in Unity.
+    /// </summary>
+    /// <seealso cref="VLFrameClock.GetFrameArrivalTime"/>
+    public double frameArrivalTime;
+
+    /// <summary>Camera image.</summary>
+    public VLImageWrapper image;
+
+    /// <summary>Snapshot of the extrinsic camera parameters.</summary>
+    public VLExtrinsicDataWrapper extrinsicData;
+
+    /// <summary>Snapshot of the intrinsic camera parameters.</summary>
+    public VLIntrinsicDataWrapper intrinsicData;
+
+    /// <summary>Tracking states and quality of all tracked objects.</summary>
+    public VLTrackingState trackingState;
+
+    /// <summary>
+    ///  Constructor of VLFrameResult.
+    /// </summary>
+    /// <param name="frameIndex">Index of the frame.</param>
+    /// <param name="frameTimestamp">Capture time of the frame in seconds.</param>
+    /// <param name="frameArrivalTime">Arrival time of the frame in seconds.</param>
+    public VLFrameResult(long frameIndex, double frameTimestamp,
+        double frameArrivalTime)
+    {
+        this.frameIndex = frameIndex;
+        this.frameTimestamp = frameTimestamp;
+        this.frameArrivalTime = frameArrivalTime;
+    }
+
+    /// <summary>
+    ///  Replaces the estimated capture time of the frame and of all members
+    ///  by the one reported by the VisionLib.
+    /// </summary>
+    /// <param name="frameTimestamp">Capture time of the frame in seconds.</param>
+    public void SetFrameTimestamp(double frameTimestamp)
+    {
+        this.frameTimestamp = frameTimestamp;
+        if (this.image != null)
+        {
+            this.image.SetFrame(this.frameIndex, frameTimestamp);
+        }
+        if (this.extrinsicData != null)
+        {
+            this.extrinsicData.SetFrame(this.frameIndex, frameTimestamp);
+        }
+        if (this.intrinsicData != null)
+        {
+            this.intrinsicData.SetFrame(this.frameIndex, frameTimestamp);
+        }
+    }
+
+    /// <summary>
+    ///  Releases the reference to the image.
+    /// </summary>
+    public void Dispose()
+    {
+        if (this.image != null)
+        {
+            this.image.Release();
+            this.image = null;
+        }
+    }
+}
+
+/**@}*/
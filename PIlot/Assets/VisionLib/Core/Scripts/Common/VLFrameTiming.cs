@@ -0,0 +1,290 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+
+/// <summary>
+///  VLFrameTiming stores the durations of the processing stages of one
+///  tracking frame in microseconds.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The VisionLib only reports the total tracking processing time
+///   through <see cref="VLPerformanceInfo"/>. It doesn't provide a
+///   breakdown into the stages of the native tracking pipeline. The other
+///   stages are measured in Unity and cover the time until a frame is
+///   available there and the time spent in the event listeners.
+///  </para>
+///  <para>
+///   The vlSDK stand-in additionally reports the acquisition, the tracking
+///   and the latency of its pipeline.
+///  </para>
+///  <para>
+///   All durations are measured in microseconds. The native stages are
+///   measured by the tracking threads of the VisionLib with its own clock.
+///   All other stages are measured on the Unity thread, which polls the
+///   events of the worker, with the monotonic clock of
+///   <see cref="VLFrameClock.GetTime"/>.
+///  </para>
+///  <para>
+///   Stages which did not occur in a frame have a duration of -1.
+///  </para>
+/// </remarks>
+public struct VLFrameTiming
+{
+    /// <summary>
+    ///  Processing stages of a tracking frame.
+    /// </summary>
+    public enum Stage
+    {
+        /// <summary>
+        ///  Native tracking processing time reported by the VisionLib.
+        ///  The VisionLib reports it with millisecond resolution.
+        /// </summary>
+        Processing = 0,
+        /// <summary>
+        ///  Time between the start of the previous and the current frame.
+        /// </summary>
+        FrameInterval = 1,
+        /// <summary>Time spent in the image listeners.</summary>
+        ImageDispatch = 2,
+        /// <summary>Time spent in the extrinsic data listeners.</summary>
+        ExtrinsicDataDispatch = 3,
+        /// <summary>Time spent in the intrinsic data listeners.</summary>
+        IntrinsicDataDispatch = 4,
+        /// <summary>Time spent in the tracking state listeners.</summary>
+        TrackingStatesDispatch = 5,
+        /// <summary>Time spent in the performance info listeners.</summary>
+        PerformanceInfoDispatch = 6,
+        /// <summary>Time spent in the frame result listeners.</summary>
+        FrameResultDispatch = 7,
+        /// <summary>Total time spent in the listeners.</summary>
+        Dispatch = 8,
+        /// <summary>
+        ///  Time between the arrival of the first event of the frame and the
+        ///  end of the last listener.
+        /// </summary>
+        Latency = 9,
+        /// <summary>
+        ///  Native time for acquiring and preprocessing the image.
+        /// </summary>
+        Acquisition = 10,
+        /// <summary>Native time for estimating the pose.</summary>
+        Tracking = 11,
+        /// <summary>
+        ///  Native time from the start of the acquisition until the pose was
+        ///  estimated.
+        /// </summary>
+        PipelineLatency = 12
+    };
+
+    /// <summary>Number of stages.</summary>
+    public const int StageCount = 13;
+
+    /// <summary>Index of the frame.</summary>
+    public long frameIndex;
+
+    /// <summary>
+    ///  Time in seconds of the monotonic clock, at which the frame arrived
+    ///  in Unity.
+    /// </summary>
+    /// <seealso cref="VLFrameClock.GetFrameArrivalTime"/>
+    public double frameTimestamp;
+
+    /// <summary>
+    ///  Native tracking processing time in microseconds with millisecond
+    ///  resolution. Measured by the tracking thread of the VisionLib.
+    /// </summary>
+    public long processing;
+
+    /// <summary>
+    ///  Time in microseconds between the arrival of the previous and the
+    ///  current frame. Measured on the Unity thread.
+    /// </summary>
+    public long frameInterval;
+
+    /// <summary>
+    ///  Time in microseconds spent in the image listeners on the Unity
+    ///  thread.
+    /// </summary>
+    public long imageDispatch;
+
+    /// <summary>
+    ///  Time in microseconds spent in the extrinsic data listeners on the
+    ///  Unity thread.
+    /// </summary>
+    public long extrinsicDataDispatch;
+
+    /// <summary>
+    ///  Time in microseconds spent in the intrinsic data listeners on the
+    ///  Unity thread.
+    /// </summary>
+    public long intrinsicDataDispatch;
+
+    /// <summary>
+    ///  Time in microseconds spent in the tracking state listeners on the
+    ///  Unity thread.
+    /// </summary>
+    public long trackingStatesDispatch;
+
+    /// <summary>
+    ///  Time in microseconds spent in the performance info listeners on the
+    ///  Unity thread.
+    /// </summary>
+    public long performanceInfoDispatch;
+
+    /// <summary>
+    ///  Time in microseconds spent in the frame result listeners on the
+    ///  Unity thread.
+    /// </summary>
+    public long frameResultDispatch;
+
+    /// <summary>
+    ///  Time in microseconds between the arrival of the first event of the
+    ///  frame and the end of its last listener. Measured on the Unity
+    ///  thread.
+    /// </summary>
+    public long latency;
+
+    /// <summary>
+    ///  Native time in microseconds for acquiring and preprocessing the
+    ///  image. Measured by the acquisition thread of the vlSDK stand-in.
+    /// </summary>
+    public long acquisition;
+
+    /// <summary>
+    ///  Native time in microseconds for estimating the pose. Measured by the
+    ///  tracking thread of the vlSDK stand-in.
+    /// </summary>
+    public long tracking;
+
+    /// <summary>
+    ///  Native time in microseconds from the start of the acquisition until
+    ///  the pose was estimated. Measured by the vlSDK stand-in with the
+    ///  clock shared by its acquisition and tracking threads.
+    /// </summary>
+    public long pipelineLatency;
+
+    /// <summary>
+    ///  Creates an empty timing record for a frame.
+    /// </summary>
+    /// <param name="frameIndex">Index of the frame.</param>
+    /// <param name="frameTimestamp">Timestamp of the frame.</param>
+    public VLFrameTiming(long frameIndex, double frameTimestamp)
+    {
+        this.frameIndex = frameIndex;
+        this.frameTimestamp = frameTimestamp;
+        this.processing = -1;
+        this.frameInterval = -1;
+        this.imageDispatch = -1;
+        this.extrinsicDataDispatch = -1;
+        this.intrinsicDataDispatch = -1;
+        this.trackingStatesDispatch = -1;
+        this.performanceInfoDispatch = -1;
+        this.frameResultDispatch = -1;
+        this.latency = -1;
+        this.acquisition = -1;
+        this.tracking = -1;
+        this.pipelineLatency = -1;
+    }
+
+    /// <summary>
+    ///  Returns the total time spent in the listeners in microseconds.
+    /// </summary>
+    public long GetDispatchTime()
+    {
+        return Math.Max(0, this.imageDispatch) +
+            Math.Max(0, this.extrinsicDataDispatch) +
+            Math.Max(0, this.intrinsicDataDispatch) +
+            Math.Max(0, this.trackingStatesDispatch) +
+            Math.Max(0, this.performanceInfoDispatch) +
+            Math.Max(0, this.frameResultDispatch);
+    }
+
+    /// <summary>
+    ///  Returns the duration of a stage in microseconds.
+    /// </summary>
+    /// <returns>
+    ///  The duration or -1, if the stage did not occur in this frame.
+    /// </returns>
+    public long GetDuration(Stage stage)
+    {
+        switch (stage)
+        {
+            case Stage.Processing:
+                return this.processing;
+            case Stage.FrameInterval:
+                return this.frameInterval;
+            case Stage.ImageDispatch:
+                return this.imageDispatch;
+            case Stage.ExtrinsicDataDispatch:
+                return this.extrinsicDataDispatch;
+            case Stage.IntrinsicDataDispatch:
+                return this.intrinsicDataDispatch;
+            case Stage.TrackingStatesDispatch:
+                return this.trackingStatesDispatch;
+            case Stage.PerformanceInfoDispatch:
+                return this.performanceInfoDispatch;
+            case Stage.FrameResultDispatch:
+                return this.frameResultDispatch;
+            case Stage.Dispatch:
+                return GetDispatchTime();
+            case Stage.Latency:
+                return this.latency;
+            case Stage.Acquisition:
+                return this.acquisition;
+            case Stage.Tracking:
+                return this.tracking;
+            case Stage.PipelineLatency:
+                return this.pipelineLatency;
+            default:
+                return -1;
+        }
+    }
+
+    /// <summary>
+    ///  Adds a duration to a dispatch stage.
+    /// </summary>
+    /// <param name="stage">One of the dispatch stages.</param>
+    /// <param name="microseconds">Duration in microseconds.</param>
+    public void AddDispatchTime(Stage stage, long microseconds)
+    {
+        switch (stage)
+        {
+            case Stage.ImageDispatch:
+                this.imageDispatch = Add(this.imageDispatch, microseconds);
+                break;
+            case Stage.ExtrinsicDataDispatch:
+                this.extrinsicDataDispatch =
+                    Add(this.extrinsicDataDispatch, microseconds);
+                break;
+            case Stage.IntrinsicDataDispatch:
+                this.intrinsicDataDispatch =
+                    Add(this.intrinsicDataDispatch, microseconds);
+                break;
+            case Stage.TrackingStatesDispatch:
+                this.trackingStatesDispatch =
+                    Add(this.trackingStatesDispatch, microseconds);
+                break;
+            case Stage.PerformanceInfoDispatch:
+                this.performanceInfoDispatch =
+                    Add(this.performanceInfoDispatch, microseconds);
+                break;
+            case Stage.FrameResultDispatch:
+                this.frameResultDispatch =
+                    Add(this.frameResultDispatch, microseconds);
+                break;
+            default:
+                throw new ArgumentException(
+                    "Not a dispatch stage: " + stage, "stage");
+        }
+    }
+
+    private static long Add(long duration, long microseconds)
+    {
+        return Math.Max(0, duration) + microseconds;
+    }
+}
+
+/**@}*/
@@ -0,0 +1,467 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+using System.Diagnostics;
+
+/// <summary>
+///  Conversion of camera images into formats understood by the VisionLib.
+/// </summary>
+/// <remarks>
+///  <para>
+///   All functions expect tightly packed images without row padding.
+///  </para>
+///  <para>
+///   Each conversion has a scalar reference implementation and a packed
+///   implementation, which processes four pixels per step using 32 bit
+///   words. The words are copied with Buffer.BlockCopy into per-thread
+///   buffers, which grow to the largest image and are reused afterwards.
+///  </para>
+///  <para>
+///   On little endian systems the packed implementation is used by default.
+///   <see cref="Calibrate"/> selects the faster implementation for each
+///   conversion by timing both variants on a small image. The
+///   VLWorkerBehaviour calls it once, when the first worker is created.
+///  </para>
+/// </remarks>
+/// <seealso cref="VLImageWrapper.CopyFromBufferWithFormat"/>
+public static class VLImageConversion
+{
+    /// <summary>
+    ///  Available conversions.
+    /// </summary>
+    public enum Conversion
+    {
+        /// <summary>BGRA to RGBA.</summary>
+        BGRAToRGBA = 0,
+        /// <summary>Luma values of YUYV to grey value.</summary>
+        YUYVToGrey = 1
+    };
+
+    /// <summary>
+    ///  Implementations of the conversions.
+    /// </summary>
+    public enum Implementation
+    {
+        /// <summary>One pixel per step.</summary>
+        Scalar = 0,
+        /// <summary>Four pixels per step using 32 bit words.</summary>
+        Packed = 1
+    };
+
+    private const int conversionCount = 2;
+    private const int calibrationPixelCount = 256 * 256;
+
+    private static Implementation[] selectedImplementations =
+        GetDefaultImplementations();
+    private static bool calibrated = false;
+
+    [ThreadStatic]
+    private static uint[] srcWords;
+    [ThreadStatic]
+    private static uint[] dstWords;
+
+    /// <summary>
+    ///  Returns the number of bytes of an image with the given format.
+    /// </summary>
+    /// <returns>
+    ///  Number of bytes or -1, if the size can't be represented by the
+    ///  format (odd width or height for subsampled formats).
+    /// </returns>
+    /// <param name="format">Format of the image.</param>
+    /// <param name="width">Width of the image in pixels.</param>
+    /// <param name="height">Height of the image in pixels.</param>
+    public static int GetBufferSize(VLUnitySdk.CameraImageFormat format,
+        int width, int height)
+    {
+        int pixelCount = width * height;
+        switch (format)
+        {
+            case VLUnitySdk.CameraImageFormat.Grey:
+                return pixelCount;
+            case VLUnitySdk.CameraImageFormat.RGB:
+                return pixelCount * 3;
+            case VLUnitySdk.CameraImageFormat.RGBA:
+            case VLUnitySdk.CameraImageFormat.BGRA:
+                return pixelCount * 4;
+            case VLUnitySdk.CameraImageFormat.NV12:
+            case VLUnitySdk.CameraImageFormat.I420:
+                if (width % 2 != 0 || height % 2 != 0)
+                {
+                    return -1;
+                }
+                return pixelCount + pixelCount / 2;
+            case VLUnitySdk.CameraImageFormat.YUYV:
+                if (width % 2 != 0)
+                {
+                    return -1;
+                }
+                return pixelCount * 2;
+        }
+
+        return -1;
+    }
+
+    /// <summary>
+    ///  Returns the implementation used for the given conversion.
+    /// </summary>
+    /// <param name="conversion">Conversion.</param>
+    public static Implementation GetImplementation(Conversion conversion)
+    {
+        return selectedImplementations[(int)conversion];
+    }
+
+    /// <summary>
+    ///  Sets the implementation used for the given conversion.
+    /// </summary>
+    /// <param name="conversion">Conversion.</param>
+    /// <param name="implementation">Implementation.</param>
+    public static void SetImplementation(Conversion conversion,
+        Implementation implementation)
+    {
+        selectedImplementations[(int)conversion] = implementation;
+    }
+
+    /// <summary>
+    ///  Selects the faster implementation for each conversion.
+    /// </summary>
+    /// <remarks>
+    ///  The calibration takes a few milliseconds and should be done once
+    ///  during the initialization, e.g. before the tracking is started.
+    /// </remarks>
+    public static void Calibrate()
+    {
+        // The packed kernels assume little endian words
+        if (!BitConverter.IsLittleEndian)
+        {
+            return;
+        }
+
+        byte[] src = new byte[calibrationPixelCount * 4];
+        byte[] dst = new byte[calibrationPixelCount * 4];
+        Implementation[] implementations = new Implementation[conversionCount];
+        for (int i = 0; i < conversionCount; ++i)
+        {
+            Conversion conversion = (Conversion)i;
+            long scalarTicks = MeasureTicks(
+                conversion, Implementation.Scalar, src, dst);
+            long packedTicks = MeasureTicks(
+                conversion, Implementation.Packed, src, dst);
+            implementations[i] = (packedTicks <= scalarTicks ?
+                Implementation.Packed : Implementation.Scalar);
+        }
+
+        selectedImplementations = implementations;
+        calibrated = true;
+    }
+
+    /// <summary>
+    ///  Returns whether <see cref="Calibrate"/> has been called.
+    /// </summary>
+    public static bool IsCalibrated()
+    {
+        return calibrated;
+    }
+
+    /// <summary>
+    ///  Converts an image with the given conversion.
+    /// </summary>
+    /// <param name="conversion">Conversion.</param>
+    /// <param name="src">Source image.</param>
+    /// <param name="dst">Destination image.</param>
+    /// <param name="pixelCount">Number of pixels.</param>
+    public static void Convert(Conversion conversion, byte[] src, byte[] dst,
+        int pixelCount)
+    {
+        Convert(conversion, GetImplementation(conversion), src, dst,
+            pixelCount);
+    }
+
+    /// <summary>
+    ///  Converts an image with the given conversion and implementation.
+    /// </summary>
+    /// <param name="conversion">Conversion.</param>
+    /// <param name="implementation">Implementation.</param>
+    /// <param name="src">Source image.</param>
+    /// <param name="dst">Destination image.</param>
+    /// <param name="pixelCount">Number of pixels.</param>
+    public static void Convert(Conversion conversion,
+        Implementation implementation, byte[] src, byte[] dst, int pixelCount)
+    {
+        if (implementation == Implementation.Packed)
+        {
+            switch (conversion)
+            {
+                case Conversion.BGRAToRGBA:
+                    SwizzleBGRAToRGBAPacked(src, dst, pixelCount);
+                    return;
+                case Conversion.YUYVToGrey:
+                    ExtractLumaYUYVPacked(src, dst, pixelCount);
+                    return;
+            }
+        }
+
+        switch (conversion)
+        {
+            case Conversion.BGRAToRGBA:
+                SwizzleBGRAToRGBAScalar(src, dst, 0, pixelCount);
+                return;
+            case Conversion.YUYVToGrey:
+                ExtractLumaYUYVScalar(src, dst, 0, pixelCount);
+                return;
+        }
+    }
+
+    /// <summary>
+    ///  Returns the number of bytes per pixel of the source and the
+    ///  destination image of a conversion.
+    /// </summary>
+    /// <param name="conversion">Conversion.</param>
+    /// <param name="srcBytesPerPixel">Bytes per source pixel.</param>
+    /// <param name="dstBytesPerPixel">Bytes per destination pixel.</param>
+    public static void GetBytesPerPixel(Conversion conversion,
+        out int srcBytesPerPixel, out int dstBytesPerPixel)
+    {
+        switch (conversion)
+        {
+            case Conversion.BGRAToRGBA:
+                srcBytesPerPixel = 4;
+                dstBytesPerPixel = 4;
+                return;
+            default:
+                srcBytesPerPixel = 2;
+                dstBytesPerPixel = 1;
+                return;
+        }
+    }
+
+    /// <summary>
+    ///  Copies the luma values of a YUYV image into a grey value image.
+    /// </summary>
+    /// <param name="src">YUYV image with pixelCount * 2 bytes.</param>
+    /// <param name="dst">Grey value image with pixelCount bytes.</param>
+    /// <param name="pixelCount">Number of pixels.</param>
+    public static void ExtractLumaYUYV(byte[] src, byte[] dst, int pixelCount)
+    {
+        Convert(Conversion.YUYVToGrey, src, dst, pixelCount);
+    }
+
+    /// <summary>
+    ///  Converts a BGRA image into an RGBA image by swapping the red and the
+    ///  blue channel.
+    /// </summary>
+    /// <param name="src">BGRA image with pixelCount * 4 bytes.</param>
+    /// <param name="dst">RGBA image with pixelCount * 4 bytes.</param>
+    /// <param name="pixelCount">Number of pixels.</param>
+    public static void SwizzleBGRAToRGBA(byte[] src, byte[] dst,
+        int pixelCount)
+    {
+        Convert(Conversion.BGRAToRGBA, src, dst, pixelCount);
+    }
+
+    /// <summary>
+    ///  Copies a rectangle of an image into a buffer with an arbitrary row
+    ///  stride and optionally downscales it.
+    /// </summary>
+    /// <remarks>
+    ///  For downscaling each destination pixel is the average of a
+    ///  <c>factor</c> x <c>factor</c> block of source pixels. Source pixels,
+    ///  which don't fill a whole block at the right or bottom border of the
+    ///  rectangle, are skipped.
+    /// </remarks>
+    /// <returns>
+    ///  <c>true</c>, if the rectangle was copied; <c>false</c>, if the
+    ///  parameters are out of range.
+    /// </returns>
+    /// <param name="src">Source image.</param>
+    /// <param name="srcStride">Bytes per row of the source image.</param>
+    /// <param name="srcWidth">Width of the source image.</param>
+    /// <param name="srcHeight">Height of the source image.</param>
+    /// <param name="bytesPerPixel">Bytes per pixel of both images.</param>
+    /// <param name="x">Left border of the rectangle.</param>
+    /// <param name="y">Top border of the rectangle.</param>
+    /// <param name="width">Width of the rectangle.</param>
+    /// <param name="height">Height of the rectangle.</param>
+    /// <param name="factor">Downscale factor (1, 2 or 4).</param>
+    /// <param name="dst">Destination buffer.</param>
+    /// <param name="dstOffset">Offset of the first destination row.</param>
+    /// <param name="dstStride">Bytes per row of the destination buffer.</param>
+    public static bool CopyRect(byte[] src, int srcStride, int srcWidth,
+        int srcHeight, int bytesPerPixel, int x, int y, int width, int height,
+        int factor, byte[] dst, int dstOffset, int dstStride)
+    {
+        if (factor != 1 && factor != 2 && factor != 4)
+        {
+            return false;
+        }
+
+        if (x < 0 || y < 0 || width <= 0 || height <= 0 ||
+            x + width > srcWidth || y + height > srcHeight)
+        {
+            return false;
+        }
+
+        int dstWidth = width / factor;
+        int dstHeight = height / factor;
+        int dstRowBytes = dstWidth * bytesPerPixel;
+        if (dstWidth == 0 || dstHeight == 0 || dstOffset < 0 ||
+            dstStride < dstRowBytes ||
+            dstOffset + (dstHeight - 1) * dstStride + dstRowBytes > dst.Length)
+        {
+            return false;
+        }
+
+        if (factor == 1)
+        {
+            int rowBytes = width * bytesPerPixel;
+            for (int row = 0; row < height; ++row)
+            {
+                Buffer.BlockCopy(
+                    src, (y + row) * srcStride + x * bytesPerPixel,
+                    dst, dstOffset + row * dstStride,
+                    rowBytes);
+            }
+            return true;
+        }
+
+        int blockArea = factor * factor;
+        int shift = (factor == 2 ? 2 : 4);
+        for (int row = 0; row < dstHeight; ++row)
+        {
+            int srcRow = (y + row * factor) * srcStride + x * bytesPerPixel;
+            int dstIndex = dstOffset + row * dstStride;
+            for (int col = 0; col < dstWidth; ++col)
+            {
+                int srcPixel = srcRow + col * factor * bytesPerPixel;
+                for (int c = 0; c < bytesPerPixel; ++c)
+                {
+                    int sum = blockArea / 2; // Round to nearest
+                    int srcIndex = srcPixel + c;
+                    for (int by = 0; by < factor; ++by)
+                    {
+                        int index = srcIndex + by * srcStride;
+                        for (int bx = 0; bx < factor; ++bx)
+                        {
+                            sum += src[index];
+                            index += bytesPerPixel;
+                        }
+                    }
+                    dst[dstIndex++] = (byte)(sum >> shift);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    private static Implementation[] GetDefaultImplementations()
+    {
+        Implementation[] implementations = new Implementation[conversionCount];
+        Implementation implementation = (BitConverter.IsLittleEndian ?
+            Implementation.Packed : Implementation.Scalar);
+        for (int i = 0; i < conversionCount; ++i)
+        {
+            implementations[i] = implementation;
+        }
+
+        return implementations;
+    }
+
+    private static long MeasureTicks(Conversion conversion,
+        Implementation implementation, byte[] src, byte[] dst)
+    {
+        // The first run only warms up the JIT
+        long bestTicks = long.MaxValue;
+        for (int run = 0; run < 6; ++run)
+        {
+            Stopwatch stopwatch = Stopwatch.StartNew();
+            Convert(conversion, implementation, src, dst,
+                calibrationPixelCount);
+            stopwatch.Stop();
+            if (run > 0)
+            {
+                bestTicks = Math.Min(bestTicks, stopwatch.ElapsedTicks);
+            }
+        }
+
+        return bestTicks;
+    }
+
+    private static void ReserveWords(int srcWordCount, int dstWordCount)
+    {
+        if (srcWords == null || srcWords.Length < srcWordCount)
+        {
+            srcWords = new uint[srcWordCount];
+        }
+        if (dstWords == null || dstWords.Length < dstWordCount)
+        {
+            dstWords = new uint[dstWordCount];
+        }
+    }
+
+    private static void ExtractLumaYUYVScalar(byte[] src, byte[] dst,
+        int begin, int end)
+    {
+        for (int i = begin, j = begin * 2; i < end; ++i, j += 2)
+        {
+            dst[i] = src[j];
+        }
+    }
+
+    private static void ExtractLumaYUYVPacked(byte[] src, byte[] dst,
+        int pixelCount)
+    {
+        int blockCount = pixelCount / 4;
+        ReserveWords(blockCount * 2, blockCount);
+        uint[] s = srcWords;
+        uint[] d = dstWords;
+        Buffer.BlockCopy(src, 0, s, 0, blockCount * 8);
+
+        // Each source word contains two pixels: Y0 U Y1 V
+        for (int i = 0, j = 0; i < blockCount; ++i, j += 2)
+        {
+            uint w0 = s[j];
+            uint w1 = s[j + 1];
+            d[i] = (w0 & 0xFFu) | ((w0 >> 8) & 0xFF00u) |
+                ((w1 & 0xFFu) << 16) | ((w1 << 8) & 0xFF000000u);
+        }
+
+        Buffer.BlockCopy(d, 0, dst, 0, blockCount * 4);
+        ExtractLumaYUYVScalar(src, dst, blockCount * 4, pixelCount);
+    }
+
+    private static void SwizzleBGRAToRGBAScalar(byte[] src, byte[] dst,
+        int begin, int end)
+    {
+        int byteEnd = end * 4;
+        for (int i = begin * 4; i < byteEnd; i += 4)
+        {
+            byte b = src[i];
+            dst[i] = src[i + 2];
+            dst[i + 1] = src[i + 1];
+            dst[i + 2] = b;
+            dst[i + 3] = src[i + 3];
+        }
+    }
+
+    private static void SwizzleBGRAToRGBAPacked(byte[] src, byte[] dst,
+        int pixelCount)
+    {
+        // The words are swizzled in place, so a single buffer is enough
+        ReserveWords(pixelCount, 0);
+        uint[] s = srcWords;
+        Buffer.BlockCopy(src, 0, s, 0, pixelCount * 4);
+
+        for (int i = 0; i < pixelCount; ++i)
+        {
+            uint w = s[i];
+            s[i] = (w & 0xFF00FF00u) | ((w >> 16) & 0xFFu) |
+                ((w & 0xFFu) << 16);
+        }
+
+        Buffer.BlockCopy(s, 0, dst, 0, pixelCount * 4);
+    }
+}
+
+/**@}*/
@@ -0,0 +1,132 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+using System.IO;
+using System.Text;
+
+/// <summary>
+///  Keeps track of the memory used by the subsystems of the tracking.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The VisionLib doesn't report its memory usage. The template memory is
+///   therefore estimated from the number of templates reported with the
+///   tracking state and an estimated size per template. The estimates
+///   should be adjusted for the used models by comparing the memory of the
+///   process for different numbers of templates on the target device.
+///  </para>
+///  <para>
+///   The image buffers are measured exactly. Files, which are loaded by
+///   the VisionLib (models, init data, calibration database), are
+///   accounted with their file size using <see cref="SetFileBytes"/>.
+///  </para>
+///  <para>
+///   All functions are thread-safe.
+///  </para>
+/// </remarks>
+public class VLMemoryAccounting
+{
+    /// <summary>
+    ///  Subsystems using memory.
+    /// </summary>
+    public enum Subsystem
+    {
+        /// <summary>Templates loaded with the init data.</summary>
+        StaticTemplates = 0,
+        /// <summary>Templates learned during the tracking.</summary>
+        DynamicTemplates = 1,
+        /// <summary>Line models used by the tracking.</summary>
+        LineModels = 2,
+        /// <summary>Geometry of the tracked models.</summary>
+        ModelGeometry = 3,
+        /// <summary>Init data read from files.</summary>
+        InitData = 4,
+        /// <summary>Image buffers of the vlUnitySDK.</summary>
+        ImageBuffers = 5,
+        /// <summary>Camera calibration database.</summary>
+        CalibrationDB = 6
+    };
+
+    /// <summary>Number of subsystems.</summary>
+    public const int SubsystemCount = 7;
+
+    private readonly long[] bytes = new long[SubsystemCount];
+
+    /// <summary>
+    ///  Sets the number of bytes used by a subsystem.
+    /// </summary>
+    public void SetBytes(Subsystem subsystem, long value)
+    {
+        lock (this.bytes)
+        {
+            this.bytes[(int)subsystem] = Math.Max(0, value);
+        }
+    }
+
+    /// <summary>
+    ///  Returns the number of bytes used by a subsystem.
+    /// </summary>
+    public long GetBytes(Subsystem subsystem)
+    {
+        lock (this.bytes)
+        {
+            return this.bytes[(int)subsystem];
+        }
+    }
+
+    /// <summary>
+    ///  Returns the number of bytes used by all subsystems.
+    /// </summary>
+    public long GetTotalBytes()
+    {
+        lock (this.bytes)
+        {
+            long total = 0;
+            for (int i = 0; i < this.bytes.Length; ++i)
+            {
+                total += this.bytes[i];
+            }
+            return total;
+        }
+    }
+
+    /// <summary>
+    ///  Sets the number of bytes used by a subsystem to the size of a file.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if the file exists; <c>false</c> otherwise. Only local
+    ///  file paths are supported, but no VisionLib URI schemes.
+    /// </returns>
+    /// <param name="subsystem">Subsystem, which loaded the file.</param>
+    /// <param name="path">Path of the file.</param>
+    public bool SetFileBytes(Subsystem subsystem, string path)
+    {
+        if (String.IsNullOrEmpty(path) || !File.Exists(path))
+        {
+            return false;
+        }
+
+        SetBytes(subsystem, new FileInfo(path).Length);
+        return true;
+    }
+
+    /// <summary>
+    ///  Returns a table with the memory used by all subsystems.
+    /// </summary>
+    public string GetReport()
+    {
+        StringBuilder report = new StringBuilder();
+        for (int i = 0; i < SubsystemCount; ++i)
+        {
+            report.AppendFormat("{0,-17} {1,10:F1} MB\n", (Subsystem)i,
+                GetBytes((Subsystem)i) / (1024.0 * 1024.0));
+        }
+        report.AppendFormat("{0,-17} {1,10:F1} MB\n", "Total",
+            GetTotalBytes() / (1024.0 * 1024.0));
+        return report.ToString();
+    }
+}
+
+/**@}*/
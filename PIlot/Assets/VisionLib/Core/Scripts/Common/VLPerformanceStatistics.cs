@@ -0,0 +1,263 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+using System.Diagnostics;
+using System.Text;
+
+/// <summary>
+///  Collects a <see cref="VLFrameTiming"/> for each tracking frame and keeps
+///  rolling histograms of the durations of all stages.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The statistics are filled by the VLWorkerBehaviour. They can be
+///   queried at any time and from any thread using
+///   <see cref="GetSummary"/> or <see cref="GetReport"/>.
+///  </para>
+///  <para>
+///   The histograms report percentiles instead of averages, because single
+///   slow frames are hidden in the average frame rate.
+///  </para>
+/// </remarks>
+public class VLPerformanceStatistics
+{
+    private static readonly double microsecondsPerTick =
+        1.0e6 / Stopwatch.Frequency;
+
+    private readonly object lockObject = new object();
+    private readonly VLRollingHistogram[] histograms;
+    private VLFrameTiming currentFrame;
+    private VLFrameTiming lastFrame;
+    private bool frameStarted = false;
+    private bool frameCompleted = false;
+    private double previousFrameTimestamp = -1.0;
+    private long lastDispatchEndTicks = 0;
+
+    /// <summary>
+    ///  Creates new statistics.
+    /// </summary>
+    /// <param name="windowSeconds">
+    ///  Duration of the rolling window of the histograms in seconds.
+    /// </param>
+    public VLPerformanceStatistics(double windowSeconds = 10.0)
+    {
+        this.histograms = new VLRollingHistogram[VLFrameTiming.StageCount];
+        for (int i = 0; i < this.histograms.Length; ++i)
+        {
+            this.histograms[i] = new VLRollingHistogram(windowSeconds);
+        }
+    }
+
+    /// <summary>
+    ///  Returns the current value of the tick counter used to measure
+    ///  dispatch times.
+    /// </summary>
+    public static long GetTicks()
+    {
+        return Stopwatch.GetTimestamp();
+    }
+
+    /// <summary>
+    ///  Starts the timing record of a new frame.
+    /// </summary>
+    /// <remarks>
+    ///  The record of the previous frame must have been finished with
+    ///  <see cref="EndFrame"/> before.
+    /// </remarks>
+    /// <param name="frameIndex">Index of the frame.</param>
+    /// <param name="frameTimestamp">
+    ///  Arrival time of the frame (see
+    ///  <see cref="VLFrameClock.GetFrameArrivalTime"/>).
+    /// </param>
+    public void BeginFrame(long frameIndex, double frameTimestamp)
+    {
+        this.currentFrame = new VLFrameTiming(frameIndex, frameTimestamp);
+        if (this.previousFrameTimestamp >= 0.0)
+        {
+            this.currentFrame.frameInterval = (long)(
+                (frameTimestamp - this.previousFrameTimestamp) * 1.0e6);
+        }
+        this.previousFrameTimestamp = frameTimestamp;
+        this.lastDispatchEndTicks = 0;
+        this.frameStarted = true;
+    }
+
+    /// <summary>
+    ///  Finishes the timing record of the current frame and adds it to the
+    ///  histograms.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if a frame was started before; <c>false</c> otherwise.
+    /// </returns>
+    /// <param name="timing">The finished timing record.</param>
+    public bool EndFrame(out VLFrameTiming timing)
+    {
+        timing = this.currentFrame;
+        if (!this.frameStarted)
+        {
+            return false;
+        }
+        this.frameStarted = false;
+
+        if (this.lastDispatchEndTicks != 0)
+        {
+            double endTime = this.lastDispatchEndTicks * microsecondsPerTick;
+            timing.latency = Math.Max(0,
+                (long)(endTime - timing.frameTimestamp * 1.0e6));
+        }
+
+        double now = VLFrameClock.GetTime();
+        for (int i = 0; i < this.histograms.Length; ++i)
+        {
+            long duration = timing.GetDuration((VLFrameTiming.Stage)i);
+            if (duration >= 0)
+            {
+                this.histograms[i].Record(duration, now);
+            }
+        }
+
+        lock (this.lockObject)
+        {
+            this.lastFrame = timing;
+            this.frameCompleted = true;
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    ///  Sets the native processing time of the current frame.
+    /// </summary>
+    /// <param name="milliseconds">
+    ///  <see cref="VLPerformanceInfo.processingTime"/>
+    /// </param>
+    public void SetProcessingTime(int milliseconds)
+    {
+        if (this.frameStarted)
+        {
+            this.currentFrame.processing = milliseconds * 1000L;
+        }
+    }
+
+    /// <summary>
+    ///  Sets the native processing time and the native stages of the
+    ///  current frame.
+    /// </summary>
+    /// <remarks>
+    ///  Stages with a duration of zero weren't reported and are ignored.
+    /// </remarks>
+    public void SetPerformanceInfo(VLPerformanceInfo performanceInfo)
+    {
+        SetProcessingTime(performanceInfo.processingTime);
+        if (!this.frameStarted)
+        {
+            return;
+        }
+        if (performanceInfo.acquisitionTime > 0.0f)
+        {
+            this.currentFrame.acquisition =
+                (long)(performanceInfo.acquisitionTime * 1000.0);
+        }
+        if (performanceInfo.trackingTime > 0.0f)
+        {
+            this.currentFrame.tracking =
+                (long)(performanceInfo.trackingTime * 1000.0);
+        }
+        if (performanceInfo.pipelineLatency > 0.0f)
+        {
+            this.currentFrame.pipelineLatency =
+                (long)(performanceInfo.pipelineLatency * 1000.0);
+        }
+    }
+
+    /// <summary>
+    ///  Adds the time since <paramref name="startTicks"/> to a dispatch stage
+    ///  of the current frame.
+    /// </summary>
+    /// <param name="stage">One of the dispatch stages.</param>
+    /// <param name="startTicks">
+    ///  Value of <see cref="GetTicks"/> at the start of the dispatch.
+    /// </param>
+    public void AddDispatchTime(VLFrameTiming.Stage stage, long startTicks)
+    {
+        if (!this.frameStarted)
+        {
+            return;
+        }
+
+        long endTicks = GetTicks();
+        this.currentFrame.AddDispatchTime(stage,
+            (long)((endTicks - startTicks) * microsecondsPerTick));
+        this.lastDispatchEndTicks = endTicks;
+    }
+
+    /// <summary>
+    ///  Returns the timing record of the last finished frame.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if a frame was finished; <c>false</c> otherwise.
+    /// </returns>
+    public bool GetLastFrameTiming(out VLFrameTiming timing)
+    {
+        lock (this.lockObject)
+        {
+            timing = this.lastFrame;
+            return this.frameCompleted;
+        }
+    }
+
+    /// <summary>
+    ///  Returns the histogram of a stage.
+    /// </summary>
+    public VLRollingHistogram GetHistogram(VLFrameTiming.Stage stage)
+    {
+        return this.histograms[(int)stage];
+    }
+
+    /// <summary>
+    ///  Returns the percentiles of a stage inside the rolling window.
+    /// </summary>
+    public VLRollingHistogram.Summary GetSummary(VLFrameTiming.Stage stage)
+    {
+        return this.histograms[(int)stage].GetSummary();
+    }
+
+    /// <summary>
+    ///  Returns a table with the percentiles of all stages in microseconds.
+    /// </summary>
+    public string GetReport()
+    {
+        StringBuilder report = new StringBuilder();
+        report.AppendLine("stage                      count     p50     p95     p99     max");
+        for (int i = 0; i < this.histograms.Length; ++i)
+        {
+            VLRollingHistogram.Summary summary =
+                this.histograms[i].GetSummary();
+            report.AppendFormat("{0,-23} {1,8} {2,7} {3,7} {4,7} {5,7}\n",
+                (VLFrameTiming.Stage)i, summary.count, summary.p50,
+                summary.p95, summary.p99, summary.max);
+        }
+        return report.ToString();
+    }
+
+    /// <summary>
+    ///  Discards all recorded frames.
+    /// </summary>
+    public void Reset()
+    {
+        for (int i = 0; i < this.histograms.Length; ++i)
+        {
+            this.histograms[i].Reset();
+        }
+        this.frameStarted = false;
+        this.previousFrameTimestamp = -1.0;
+        lock (this.lockObject)
+        {
+            this.frameCompleted = false;
+        }
+    }
+}
+
+/**@}*/
@@ -0,0 +1,336 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+
+/// <summary>
+///  Extrapolates the camera pose to a given point in time.
+/// </summary>
+/// <remarks>
+///  <para>
+///   Each pose received from the VisionLib is one processing latency old.
+///   The VLPosePredictor keeps a short history of poses and extrapolates
+///   them with a constant velocity model (linear velocity for the
+///   translation, angular velocity for the rotation). The velocity is
+///   averaged over the poses of the last <see cref="velocityWindow"/>
+///   seconds and limited to <see cref="maxLinearVelocity"/> and
+///   <see cref="maxAngularVelocity"/>. Poses, which are closer together
+///   than <see cref="minVelocitySpan"/>, aren't extrapolated, because
+///   the jitter of their timestamps would dominate the velocity.
+///  </para>
+///  <para>
+///   Poses are stored as transformation from world to camera coordinates
+///   (see <see cref="VLExtrinsicDataWrapper.GetT"/> and
+///   <see cref="VLExtrinsicDataWrapper.GetR"/>) together with the capture
+///   time of their frame. The extrinsic data arrives before the capture
+///   time, so its pose is only added to the history by
+///   <see cref="SetCaptureTime"/>. An invalid pose clears the history. The
+///   VLPosePredictor is not thread-safe.
+///  </para>
+/// </remarks>
+public class VLPosePredictor
+{
+    private struct Sample
+    {
+        public double time;
+        public double tx, ty, tz;
+        public double qx, qy, qz, qw;
+    }
+
+    /// <summary>
+    ///  Time span in seconds over which the velocity is averaged.
+    /// </summary>
+    public double velocityWindow = 0.1;
+
+    /// <summary>
+    ///  Maximum time in seconds the newest pose will be extrapolated.
+    /// </summary>
+    public double maxPredictionTime = 0.2;
+
+    /// <summary>
+    ///  Minimum time span in seconds between the poses used for the
+    ///  velocity. It should be at least half the frame period of the camera.
+    /// </summary>
+    public double minVelocitySpan = 1.0 / 60.0;
+
+    /// <summary>
+    ///  Maximum linear velocity in units of the translation per second.
+    /// </summary>
+    public double maxLinearVelocity = 2.0;
+
+    /// <summary>
+    ///  Maximum angular velocity in radians per second.
+    /// </summary>
+    public double maxAngularVelocity = 2.0 * Math.PI;
+
+    private Sample[] history;
+    private int count = 0;
+    private int newest = -1;
+
+    // Pose of the extrinsic data waiting for the capture time of its frame
+    private bool hasPendingSample = false;
+    private long pendingFrameIndex = -1;
+    private float[] pendingT = new float[3];
+    private float[] pendingQ = new float[4];
+
+    private float[] t = new float[3];
+    private float[] q = new float[4];
+
+    /// <summary>
+    ///  Constructor of VLPosePredictor.
+    /// </summary>
+    public VLPosePredictor()
+        : this(8)
+    {
+    }
+
+    /// <summary>
+    ///  Constructor of VLPosePredictor.
+    /// </summary>
+    /// <param name="historySize">Maximum number of stored poses.</param>
+    public VLPosePredictor(int historySize)
+    {
+        this.history = new Sample[Math.Max(historySize, 2)];
+    }
+
+    /// <summary>
+    ///  Removes all poses from the history.
+    /// </summary>
+    public void Reset()
+    {
+        this.count = 0;
+        this.newest = -1;
+        this.hasPendingSample = false;
+    }
+
+    /// <summary>
+    ///  Keeps the pose of the given extrinsic data until the capture time of
+    ///  its frame is passed to <see cref="SetCaptureTime"/>.
+    /// </summary>
+    /// <remarks>
+    ///  The timestamp of the extrinsic data is only an estimate and therefore
+    ///  not used for the extrapolation.
+    /// </remarks>
+    /// <param name="extrinsicData">Extrinsic data of a frame.</param>
+    public void AddSample(VLExtrinsicDataWrapper extrinsicData)
+    {
+        if (!extrinsicData.GetValid() ||
+            !extrinsicData.GetT(this.pendingT) ||
+            !extrinsicData.GetR(this.pendingQ))
+        {
+            Reset();
+            return;
+        }
+
+        this.hasPendingSample = true;
+        this.pendingFrameIndex = extrinsicData.GetFrameIndex();
+    }
+
+    /// <summary>
+    ///  Adds the pose passed to <see cref="AddSample(VLExtrinsicDataWrapper)"/>
+    ///  to the history, if it belongs to the given frame.
+    /// </summary>
+    /// <param name="frameIndex">Index of the frame.</param>
+    /// <param name="captureTime">
+    ///  Capture time of the frame reported by the VisionLib (see
+    ///  <see cref="VLFrameClock.GetFrameTimestamp"/>).
+    /// </param>
+    public void SetCaptureTime(long frameIndex, double captureTime)
+    {
+        if (!this.hasPendingSample || this.pendingFrameIndex != frameIndex)
+        {
+            return;
+        }
+
+        this.hasPendingSample = false;
+        AddSample(this.pendingT, this.pendingQ, captureTime);
+    }
+
+    /// <summary>
+    ///  Adds a valid pose to the history.
+    /// </summary>
+    /// <param name="t">Translation (x, y, z).</param>
+    /// <param name="q">Rotation as quaternion (x, y, z, w).</param>
+    /// <param name="timestamp">Timestamp of the pose in seconds.</param>
+    public void AddSample(float[] t, float[] q, double timestamp)
+    {
+        // Ignore poses, which are older than the newest one
+        if (this.count > 0 && timestamp <= this.history[this.newest].time)
+        {
+            return;
+        }
+
+        this.newest = (this.newest + 1) % this.history.Length;
+        this.count = Math.Min(this.count + 1, this.history.Length);
+
+        Sample sample;
+        sample.time = timestamp;
+        sample.tx = t[0];
+        sample.ty = t[1];
+        sample.tz = t[2];
+        sample.qx = q[0];
+        sample.qy = q[1];
+        sample.qz = q[2];
+        sample.qw = q[3];
+        this.history[this.newest] = sample;
+    }
+
+    /// <summary>
+    ///  Extrapolates the pose to the given point in time.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if a pose is available;
+    ///  <c>false</c>, if the history is empty.
+    /// </returns>
+    /// <param name="timestamp">
+    ///  Point in time in seconds (see <see cref="VLFrameClock.GetTime"/>).
+    /// </param>
+    /// <param name="t">Float array for storing the translation.</param>
+    /// <param name="q">Float array for storing the rotation.</param>
+    public bool Predict(double timestamp, float[] t, float[] q)
+    {
+        if (this.count == 0)
+        {
+            return false;
+        }
+
+        Sample latest = this.history[this.newest];
+
+        // Find the oldest pose inside the velocity window (at least the
+        // previous pose)
+        Sample reference = latest;
+        for (int i = 1; i < this.count; ++i)
+        {
+            Sample sample = this.history[
+                (this.newest - i + this.history.Length) % this.history.Length];
+            if (i > 1 && latest.time - sample.time > this.velocityWindow)
+            {
+                break;
+            }
+            reference = sample;
+        }
+
+        double span = latest.time - reference.time;
+        double horizon = Math.Min(
+            Math.Max(timestamp - latest.time, 0.0), this.maxPredictionTime);
+        double f = (span >= this.minVelocitySpan &&
+            span > 0.0 ? horizon / span : 0.0);
+
+        // Limit the linear velocity
+        double vx = latest.tx - reference.tx;
+        double vy = latest.ty - reference.ty;
+        double vz = latest.tz - reference.tz;
+        double distance = Math.Sqrt(vx * vx + vy * vy + vz * vz);
+        double ft = f;
+        if (distance * f > this.maxLinearVelocity * horizon)
+        {
+            ft = this.maxLinearVelocity * horizon / distance;
+        }
+
+        t[0] = (float)(latest.tx + vx * ft);
+        t[1] = (float)(latest.ty + vy * ft);
+        t[2] = (float)(latest.tz + vz * ft);
+
+        // Rotation from the reference to the latest pose:
+        // d = latest * conjugate(reference)
+        double dx = -latest.qw * reference.qx + latest.qx * reference.qw -
+            latest.qy * reference.qz + latest.qz * reference.qy;
+        double dy = -latest.qw * reference.qy + latest.qy * reference.qw -
+            latest.qz * reference.qx + latest.qx * reference.qz;
+        double dz = -latest.qw * reference.qz + latest.qz * reference.qw -
+            latest.qx * reference.qy + latest.qy * reference.qx;
+        double dw = latest.qw * reference.qw + latest.qx * reference.qx +
+            latest.qy * reference.qy + latest.qz * reference.qz;
+
+        // Use the shorter rotation
+        if (dw < 0.0)
+        {
+            dx = -dx;
+            dy = -dy;
+            dz = -dz;
+            dw = -dw;
+        }
+
+        // Scale the rotation angle of d by f and limit the angular velocity
+        double sinHalf = Math.Sqrt(dx * dx + dy * dy + dz * dz);
+        double rx = 0.0, ry = 0.0, rz = 0.0, rw = 1.0;
+        if (sinHalf > 1e-9)
+        {
+            double halfAngle = Math.Min(Math.Atan2(sinHalf, dw) * f,
+                0.5 * this.maxAngularVelocity * horizon);
+            double scale = Math.Sin(halfAngle) / sinHalf;
+            rx = dx * scale;
+            ry = dy * scale;
+            rz = dz * scale;
+            rw = Math.Cos(halfAngle);
+        }
+
+        // Apply the scaled rotation to the latest pose: r * latest
+        double px = rw * latest.qx + rx * latest.qw + ry * latest.qz -
+            rz * latest.qy;
+        double py = rw * latest.qy - rx * latest.qz + ry * latest.qw +
+            rz * latest.qx;
+        double pz = rw * latest.qz + rx * latest.qy - ry * latest.qx +
+            rz * latest.qw;
+        double pw = rw * latest.qw - rx * latest.qx - ry * latest.qy -
+            rz * latest.qz;
+        double norm = Math.Sqrt(px * px + py * py + pz * pz + pw * pw);
+        q[0] = (float)(px / norm);
+        q[1] = (float)(py / norm);
+        q[2] = (float)(pz / norm);
+        q[3] = (float)(pw / norm);
+
+        return true;
+    }
+
+    /// <summary>
+    ///  Extrapolates the pose to the given point in time and returns it as
+    ///  model-view matrix.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if a pose is available;
+    ///  <c>false</c>, if the history is empty.
+    /// </returns>
+    /// <param name="timestamp">
+    ///  Point in time in seconds (see <see cref="VLFrameClock.GetTime"/>).
+    /// </param>
+    /// <param name="modelViewMatrix">
+    ///  Float array with 16 elements for storing the model-view matrix in
+    ///  column-major order (see
+    ///  <see cref="VLExtrinsicDataWrapper.GetModelViewMatrix"/>).
+    /// </param>
+    public bool Predict(double timestamp, float[] modelViewMatrix)
+    {
+        if (!Predict(timestamp, this.t, this.q))
+        {
+            return false;
+        }
+
+        float x = this.q[0];
+        float y = this.q[1];
+        float z = this.q[2];
+        float w = this.q[3];
+
+        modelViewMatrix[0] = 1.0f - 2.0f * (y * y + z * z);
+        modelViewMatrix[1] = 2.0f * (x * y + z * w);
+        modelViewMatrix[2] = 2.0f * (x * z - y * w);
+        modelViewMatrix[3] = 0.0f;
+        modelViewMatrix[4] = 2.0f * (x * y - z * w);
+        modelViewMatrix[5] = 1.0f - 2.0f * (x * x + z * z);
+        modelViewMatrix[6] = 2.0f * (y * z + x * w);
+        modelViewMatrix[7] = 0.0f;
+        modelViewMatrix[8] = 2.0f * (x * z + y * w);
+        modelViewMatrix[9] = 2.0f * (y * z - x * w);
+        modelViewMatrix[10] = 1.0f - 2.0f * (x * x + y * y);
+        modelViewMatrix[11] = 0.0f;
+        modelViewMatrix[12] = this.t[0];
+        modelViewMatrix[13] = this.t[1];
+        modelViewMatrix[14] = this.t[2];
+        modelViewMatrix[15] = 1.0f;
+
+        return true;
+    }
+}
+
+/**@}*/
@@ -0,0 +1,142 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+using System.Threading;
+
+/// <summary>
+///  Stores the most recent camera pose, so it can be read from any thread.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The pose is published by a single writer (the
+///   <see cref="VLWorkerBehaviour"/> during the processing of the extrinsic
+///   data) and protected by a sequence lock. Readers never block the writer
+///   and don't acquire any locks. A reader only repeats its copy, if the
+///   pose was updated while reading.
+///  </para>
+///  <para>
+///   This allows e.g. a render thread to sample the latest pose right
+///   before rendering instead of waiting for the next listener callback.
+///  </para>
+///  <para>
+///   The pose is published with the estimated timestamp of its frame. Once
+///   the capture time arrives with the tracking states, the timestamp is
+///   replaced using <see cref="SetFrameTimestamp"/>.
+///  </para>
+/// </remarks>
+/// <seealso cref="VLWorkerBehaviour.GetLatestPose"/>
+public class VLPosePublisher
+{
+    // Odd while a pose is written, even otherwise
+    private int sequence = 0;
+    private float[] modelViewMatrix = new float[16];
+    private bool valid = false;
+    private long frameIndex = -1;
+    private double frameTimestamp = 0.0;
+
+    /// <summary>
+    ///  Publishes a new pose.
+    /// </summary>
+    /// <remarks>
+    ///  Must only be called from one thread at a time.
+    /// </remarks>
+    /// <param name="modelViewMatrix">
+    ///  Model-view matrix with 16 elements in column-major order.
+    /// </param>
+    /// <param name="valid">Whether the pose is valid.</param>
+    /// <param name="frameIndex">Index of the frame of the pose.</param>
+    /// <param name="frameTimestamp">
+    ///  Monotonic timestamp of the frame in seconds.
+    /// </param>
+    public void Publish(float[] modelViewMatrix, bool valid, long frameIndex,
+        double frameTimestamp)
+    {
+        int seq = this.sequence;
+        Volatile.Write(ref this.sequence, seq + 1);
+        Thread.MemoryBarrier();
+
+        Array.Copy(modelViewMatrix, this.modelViewMatrix, 16);
+        this.valid = valid;
+        this.frameIndex = frameIndex;
+        this.frameTimestamp = frameTimestamp;
+
+        Volatile.Write(ref this.sequence, seq + 2);
+    }
+
+    /// <summary>
+    ///  Replaces the timestamp of the published pose.
+    /// </summary>
+    /// <remarks>
+    ///  Must only be called from the thread, which publishes the poses.
+    /// </remarks>
+    /// <returns>
+    ///  <c>true</c>, if the published pose belongs to the given frame;
+    ///  <c>false</c> otherwise.
+    /// </returns>
+    /// <param name="frameIndex">Index of the frame.</param>
+    /// <param name="frameTimestamp">
+    ///  Monotonic capture time of the frame in seconds.
+    /// </param>
+    public bool SetFrameTimestamp(long frameIndex, double frameTimestamp)
+    {
+        // Only the writer modifies the frame index
+        if (this.sequence == 0 || this.frameIndex != frameIndex)
+        {
+            return false;
+        }
+
+        int seq = this.sequence;
+        Volatile.Write(ref this.sequence, seq + 1);
+        Thread.MemoryBarrier();
+
+        this.frameTimestamp = frameTimestamp;
+
+        Volatile.Write(ref this.sequence, seq + 2);
+        return true;
+    }
+
+    /// <summary>
+    ///  Reads the most recent pose.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if a pose was published before;
+    ///  <c>false</c> otherwise.
+    /// </returns>
+    /// <param name="modelViewMatrix">
+    ///  Float array with 16 elements for storing the model-view matrix.
+    /// </param>
+    /// <param name="valid">Whether the pose is valid.</param>
+    /// <param name="frameIndex">Index of the frame of the pose.</param>
+    /// <param name="frameTimestamp">
+    ///  Monotonic timestamp of the frame in seconds.
+    /// </param>
+    public bool Read(float[] modelViewMatrix, out bool valid,
+        out long frameIndex, out double frameTimestamp)
+    {
+        while (true)
+        {
+            int seqBefore = Volatile.Read(ref this.sequence);
+            if ((seqBefore & 1) != 0)
+            {
+                // Writer is active
+                Thread.SpinWait(1);
+                continue;
+            }
+
+            Array.Copy(this.modelViewMatrix, modelViewMatrix, 16);
+            valid = this.valid;
+            frameIndex = this.frameIndex;
+            frameTimestamp = this.frameTimestamp;
+
+            Thread.MemoryBarrier();
+            if (Volatile.Read(ref this.sequence) == seqBefore)
+            {
+                return seqBefore != 0;
+            }
+        }
+    }
+}
+
+/**@}*/
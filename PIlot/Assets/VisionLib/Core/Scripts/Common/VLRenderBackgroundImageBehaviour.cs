@@ -63,7 +63,6 @@ public class VLRenderBackgroundImageBehaviour : MonoBehaviour
         public MeshRenderer meshRenderer = null;
         public Material material = null;
         public Texture2D texture = null;
-        public byte[] textureData = new byte[1];
     }
 
     //private ClearCameraData clearCameraData = null;
@@ -225,7 +224,6 @@ public class VLRenderBackgroundImageBehaviour : MonoBehaviour
 
         // Create texture (will be set properly later)
         data.texture = Texture2D.blackTexture;
-        data.textureData = new byte[1];
 
         // Create Material
         data.material = new Material(material);
@@ -338,15 +336,10 @@ public class VLRenderBackgroundImageBehaviour : MonoBehaviour
         int imageHeight = image.GetHeight();
         if (imageWidth > 0 && imageHeight > 0)
         {
-            int imageByteSize = imageWidth * imageHeight *
-                image.GetBytesPerPixel();
-            if (this.backgroundMeshData0.textureData.Length != imageByteSize)
-            {
-                this.backgroundMeshData0.textureData = new byte[imageByteSize];
-            }
-
-            // Copy the image into a byte array
-            if (image.CopyToBuffer(this.backgroundMeshData0.textureData))
+            // Access the image data without copying it into an own byte array
+            byte[] imageData;
+            int imageStride;
+            if (image.Lock(out imageData, out imageStride))
             {
                 // Generate a texture from the byte array
                 if (!this.backgroundMeshData0.texture ||
@@ -365,9 +358,11 @@ public class VLRenderBackgroundImageBehaviour : MonoBehaviour
                 if (this.backgroundMeshData0.texture)
                 {
                     this.backgroundMeshData0.texture.LoadRawTextureData(
-                        this.backgroundMeshData0.textureData);
+                        imageData);
                     this.backgroundMeshData0.texture.Apply();
                 }
+
+                image.Unlock();
             }
         }
         else
@@ -424,7 +419,10 @@ public class VLRenderBackgroundImageBehaviour : MonoBehaviour
         VLDetectScreenChangeBehaviour.OnOrientationChange += OnOrientationChange;
         VLDetectScreenChangeBehaviour.OnSizeChange += OnScreenSizeChange;
 
-        VLWorkerBehaviour.OnImage += OnImage;
+        // Skip stale images, if several images were queued (e.g. after
+        // loading a scene)
+        VLWorkerBehaviour.AddImageListener(
+            OnImage, VLDeliveryPolicy.LatestOnly);
         this.backgroundGO.SetActive(true);
     }
 
@@ -435,7 +433,7 @@ public class VLRenderBackgroundImageBehaviour : MonoBehaviour
         {
             this.backgroundGO.SetActive(false);
         }
-        VLWorkerBehaviour.OnImage -= OnImage;
+        VLWorkerBehaviour.RemoveImageListener(OnImage);
 
         VLDetectScreenChangeBehaviour.OnSizeChange -= OnScreenSizeChange;
         VLDetectScreenChangeBehaviour.OnOrientationChange -= OnOrientationChange;
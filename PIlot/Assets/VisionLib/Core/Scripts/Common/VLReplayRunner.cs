@@ -0,0 +1,709 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using AOT;
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using VLWorkerCommands;
+
+/// <summary>
+///  Replays a recorded image sequence through a synchronous worker as fast
+///  as possible and measures the performance and the tracking quality.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The frames are processed one by one using
+///   <see cref="VLWorker.RunOnceSync"/>, so the results don't depend on the
+///   speed of the machine. Two runs with the same SDK version, tracking
+///   configuration and image sequence should therefore produce the same
+///   <see cref="Result.resultHash"/>.
+///  </para>
+///  <para>
+///   The image sequence can be recorded with the imageRecorder tracker.
+///  </para>
+/// </remarks>
+public class VLReplayRunner : IDisposable
+{
+    /// <summary>
+    ///  Results of a replay.
+    /// </summary>
+    [Serializable]
+    public class Result
+    {
+        /// <summary>Tracking configuration used for the replay.</summary>
+        public string trackingConfig;
+        /// <summary>URI of the replayed image sequence.</summary>
+        public string imageSequence;
+        /// <summary>Number of processed frames.</summary>
+        public int frames;
+        /// <summary>Total processing time in seconds.</summary>
+        public double seconds;
+        /// <summary>Processed frames per second.</summary>
+        public double framesPerSecond;
+        /// <summary>Median processing time of a frame in milliseconds.</summary>
+        public double latencyP50;
+        /// <summary>95th percentile of the processing time in milliseconds.</summary>
+        public double latencyP95;
+        /// <summary>99th percentile of the processing time in milliseconds.</summary>
+        public double latencyP99;
+        /// <summary>Maximum processing time in milliseconds.</summary>
+        public double latencyMax;
+        /// <summary>Ratio of frames with the tracking state "tracked".</summary>
+        public double trackedRatio;
+        /// <summary>Ratio of frames with the tracking state "critical".</summary>
+        public double criticalRatio;
+        /// <summary>Ratio of frames with the tracking state "lost".</summary>
+        public double lostRatio;
+        /// <summary>
+        ///  Root mean square of the second difference of the translation of
+        ///  consecutive tracked frames in the metric of the tracking
+        ///  configuration.
+        /// </summary>
+        public double translationJitter;
+        /// <summary>
+        ///  Root mean square of the second difference of the rotation of
+        ///  consecutive tracked frames in degrees.
+        /// </summary>
+        public double rotationJitter;
+        /// <summary>
+        ///  Hash of the tracking states and the rounded poses of all frames.
+        /// </summary>
+        public string resultHash;
+        /// <summary>
+        ///  Number of tracked frames, which were compared with the ground
+        ///  truth.
+        /// </summary>
+        public int evaluatedFrames;
+        /// <summary>
+        ///  Mean distance between the tracked and the ground truth
+        ///  translation in the metric of the tracking configuration.
+        /// </summary>
+        public double translationError;
+        /// <summary>
+        ///  Mean angle between the tracked and the ground truth rotation in
+        ///  degrees.
+        /// </summary>
+        public double rotationError;
+    }
+
+    private static VLReplayRunner GetInstance(IntPtr clientData)
+    {
+        return (VLReplayRunner)GCHandle.FromIntPtr(clientData).Target;
+    }
+
+    [MonoPInvokeCallback(typeof(VLWorker.JsonStringCallback))]
+    private static void DispatchCommandCallback(string errorJson,
+        string resultJson, IntPtr clientData)
+    {
+        try
+        {
+            VLReplayRunner runner = GetInstance(clientData);
+            runner.commandFinished = true;
+            runner.commandError = errorJson;
+        }
+        catch (Exception e) // Catch all exceptions, because this is a callback
+                            // invoked from native code
+        {
+            UnityEngine.Debug.LogError("[vlUnitySDK] " + e.GetType().Name +
+                ": " + e.Message);
+        }
+    }
+    private static VLWorker.JsonStringCallback dispatchCommandCallbackDelegate =
+        new VLWorker.JsonStringCallback(DispatchCommandCallback);
+
+    [MonoPInvokeCallback(typeof(VLWorker.ExtrinsicDataWrapperCallback))]
+    private static void DispatchExtrinsicDataCallback(IntPtr handle,
+        IntPtr clientData)
+    {
+        try
+        {
+            GetInstance(clientData).ExtrinsicDataHandler(handle);
+        }
+        catch (Exception e) // Catch all exceptions, because this is a callback
+                            // invoked from native code
+        {
+            UnityEngine.Debug.LogError("[vlUnitySDK] " + e.GetType().Name +
+                ": " + e.Message);
+        }
+    }
+    private static VLWorker.ExtrinsicDataWrapperCallback dispatchExtrinsicDataCallbackDelegate =
+        new VLWorker.ExtrinsicDataWrapperCallback(DispatchExtrinsicDataCallback);
+
+    [MonoPInvokeCallback(typeof(VLWorker.StringCallback))]
+    private static void DispatchTrackingStateCallback(string trackingStateJson,
+        IntPtr clientData)
+    {
+        try
+        {
+            GetInstance(clientData).TrackingStateHandler(trackingStateJson);
+        }
+        catch (Exception e) // Catch all exceptions, because this is a callback
+                            // invoked from native code
+        {
+            UnityEngine.Debug.LogError("[vlUnitySDK] " + e.GetType().Name +
+                ": " + e.Message);
+        }
+    }
+    private static VLWorker.StringCallback dispatchTrackingStateCallbackDelegate =
+        new VLWorker.StringCallback(DispatchTrackingStateCallback);
+
+    private GCHandle gcHandle;
+    private bool disposed = false;
+    private VLAbstractApplicationWrapper aap;
+    private VLLogger logger;
+    private VLWorker worker;
+    private string trackingConfig = "";
+    private string imageSequence = "";
+    private VLGroundTruth groundTruth = null;
+
+    private bool commandFinished = false;
+    private string commandError = null;
+
+    private VLTrackingStateInfo.State frameState;
+    private bool frameHasPose = false;
+    private float[] frameT = new float[3];
+    private float[] frameQ = new float[4];
+
+    /// <summary>
+    ///  Constructor of VLReplayRunner.
+    /// </summary>
+    /// <param name="licenseFilePath">Path of the license file.</param>
+    /// <param name="pluginPath">
+    ///  Directory with the plugins of the VisionLib.
+    /// </param>
+    /// <param name="forwardLogs">
+    ///  Whether the log messages of the VisionLib should be written to the
+    ///  Unity console. The log listeners are global, therefore only one of
+    ///  several concurrent replays should forward the logs.
+    /// </param>
+    /// <param name="workerOptions">
+    ///  Concurrency options of the worker or <c>null</c>.
+    /// </param>
+    public VLReplayRunner(string licenseFilePath, string pluginPath,
+        bool forwardLogs = true, VLWorkerOptions workerOptions = null)
+    {
+        this.gcHandle = GCHandle.Alloc(this);
+
+        this.aap = new VLAbstractApplicationWrapper();
+        this.aap.SetLicenseFilePath(licenseFilePath);
+
+        if (forwardLogs)
+        {
+            this.logger = new VLLogger();
+            this.logger.EnableLogBuffer();
+        }
+
+        this.aap.AutoLoadPlugins(pluginPath);
+
+        this.worker = new VLWorker(this.aap, workerOptions, true);
+        IntPtr clientData = GCHandle.ToIntPtr(this.gcHandle);
+        if (!this.worker.AddExtrinsicDataListener(
+            dispatchExtrinsicDataCallbackDelegate, clientData))
+        {
+            UnityEngine.Debug.LogWarning("[vlUnitySDK] Failed to add extrinsic data listener");
+        }
+        if (!this.worker.AddTrackingStateListener(
+            dispatchTrackingStateCallbackDelegate, clientData))
+        {
+            UnityEngine.Debug.LogWarning("[vlUnitySDK] Failed to add tracking state listener");
+        }
+    }
+
+    ~VLReplayRunner()
+    {
+        // The finalizer was called implicitly from the garbage collector
+        this.Dispose(false);
+    }
+
+    private void Dispose(bool disposing)
+    {
+        // Prevent multiple calls to Dispose
+        if (this.disposed)
+        {
+            return;
+        }
+
+        // Was dispose called explicitly by the user?
+        if (disposing)
+        {
+            // Dispose managed resources (those that implement IDisposable)
+            IntPtr clientData = GCHandle.ToIntPtr(this.gcHandle);
+            this.worker.RemoveTrackingStateListener(
+                dispatchTrackingStateCallbackDelegate, clientData);
+            this.worker.RemoveExtrinsicDataListener(
+                dispatchExtrinsicDataCallbackDelegate, clientData);
+            this.worker.Dispose();
+            if (this.logger != null)
+            {
+                this.logger.FlushLogBuffer();
+                this.logger.Dispose();
+            }
+            this.aap.Dispose();
+        }
+
+        // Release the handle to the current object
+        this.gcHandle.Free();
+
+        this.disposed = true;
+    }
+
+    /// <summary>
+    ///  Explicitly releases references to unmanaged resources.
+    /// </summary>
+    /// <remarks>Call <see cref="Dispose"/> when you are finished using the
+    ///  <see cref="VLReplayRunner"/>. The <see cref="Dispose"/> method leaves
+    ///  the <see cref="VLReplayRunner"/> in an unusable state. After calling
+    ///  <see cref="Dispose"/>, you must release all references to the
+    ///  <see cref="VLReplayRunner"/> so the garbage collector can reclaim the
+    ///  memory that the <see cref="VLReplayRunner"/> was occupying.
+    /// </remarks>
+    public void Dispose()
+    {
+        Dispose(true); // Dispose was explicitly called by the user
+        GC.SuppressFinalize(this);
+    }
+
+    /// <summary>
+    ///  Returns the AbstractApplication used for the replay.
+    /// </summary>
+    public VLAbstractApplicationWrapper GetApplication()
+    {
+        return this.aap;
+    }
+
+    /// <summary>
+    ///  Returns the synchronous worker used for the replay.
+    /// </summary>
+    /// <remarks>
+    ///  Can be used to push additional commands (e.g. setAttribute) after
+    ///  the tracker was created.
+    /// </remarks>
+    public VLWorker GetWorker()
+    {
+        return this.worker;
+    }
+
+    /// <summary>
+    ///  Sets the ground truth poses for evaluating the accuracy of the
+    ///  tracking.
+    /// </summary>
+    /// <remarks>
+    ///  The first processed frame is compared with the first pose. This
+    ///  requires that the replay starts with the first image of the sequence.
+    /// </remarks>
+    /// <param name="groundTruth">
+    ///  Ground truth, e.g. written by the synthetic sequence generator, or
+    ///  <c>null</c>.
+    /// </param>
+    public void SetGroundTruth(VLGroundTruth groundTruth)
+    {
+        this.groundTruth = groundTruth;
+    }
+
+    /// <summary>
+    ///  Adds an image sequence input to a tracking configuration.
+    /// </summary>
+    /// <returns>
+    ///  The modified tracking configuration or <c>null</c>, if the tracking
+    ///  configuration already contains an input section.
+    /// </returns>
+    /// <param name="config">Content of a vl-file.</param>
+    /// <param name="imageSequenceURI">
+    ///  URI of the images, e.g.
+    ///  "local_storage_dir:records/record/image_*.jpg".
+    /// </param>
+    /// <param name="deviceID">
+    ///  Device ID for selecting the camera calibration or <c>null</c>.
+    /// </param>
+    public static string AddImageSequenceInput(string config,
+        string imageSequenceURI, string deviceID = null)
+    {
+        int end = config.LastIndexOf('}');
+        if (end < 0 || config.Contains("\"input\""))
+        {
+            return null;
+        }
+
+        string input =
+            ",\n  \"input\": {\n" +
+            "    \"useImageSource\": \"imageSequence\",\n" +
+            "    \"imageSources\": [{\n" +
+            "      \"name\": \"imageSequence\",\n" +
+            "      \"type\": \"imageSequence\",\n" +
+            "      \"data\": {\"uri\": \"" + imageSequenceURI + "\"" +
+                (deviceID != null ?
+                    ", \"deviceID\": \"" + deviceID + "\"" : "") + "}\n" +
+            "    }]\n" +
+            "  }\n";
+        return config.Substring(0, end).TrimEnd() + input +
+            config.Substring(end);
+    }
+
+    /// <summary>
+    ///  Creates the tracker.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if the tracker was created and started successfully;
+    ///  <c>false</c> otherwise.
+    /// </returns>
+    /// <param name="trackingConfigPath">Path of the vl-file.</param>
+    /// <param name="imageSequenceURI">
+    ///  URI of the image sequence or <c>null</c>, if the vl-file already
+    ///  contains the input section.
+    /// </param>
+    /// <param name="attributes">
+    ///  Attributes, which will be set before the tracking starts.
+    /// </param>
+    public bool CreateTracker(string trackingConfigPath,
+        string imageSequenceURI, SetAttributeCmd.Param[] attributes = null)
+    {
+        this.trackingConfig = trackingConfigPath;
+        this.imageSequence =
+            (imageSequenceURI != null ? imageSequenceURI : "");
+
+        CommandBase createCmd;
+        if (String.IsNullOrEmpty(imageSequenceURI))
+        {
+            createCmd = new CreateTrackerCmd(trackingConfigPath);
+        }
+        else
+        {
+            string config = AddImageSequenceInput(
+                System.IO.File.ReadAllText(trackingConfigPath),
+                imageSequenceURI);
+            if (config == null)
+            {
+                UnityEngine.Debug.LogError("[vlUnitySDK] '" +
+                    trackingConfigPath + "' already contains an input section");
+                return false;
+            }
+            createCmd = new CreateTrackerFromStringCmd(
+                new CreateTrackerFromStringCmd.Param(config,
+                    trackingConfigPath));
+        }
+
+        if (!RunCommand(createCmd))
+        {
+            return false;
+        }
+
+        if (attributes != null)
+        {
+            foreach (SetAttributeCmd.Param attribute in attributes)
+            {
+                if (!RunCommand(new SetAttributeCmd(attribute)))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return RunCommand(new RunTrackingCmd());
+    }
+
+    /// <summary>
+    ///  Pushes a command and processes frames until its callback was called.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if the command was processed successfully;
+    ///  <c>false</c> otherwise.
+    /// </returns>
+    public bool RunCommand(CommandBase cmd, int maxIterations = 1000)
+    {
+        this.commandFinished = false;
+        this.commandError = null;
+        if (!this.worker.PushCommand(cmd, dispatchCommandCallbackDelegate,
+            GCHandle.ToIntPtr(this.gcHandle)))
+        {
+            return false;
+        }
+
+        for (int i = 0; i < maxIterations && !this.commandFinished; ++i)
+        {
+            this.worker.RunOnceSync();
+            this.worker.ProcessCallbacks();
+            this.worker.PollEvents();
+            FlushLogBuffer();
+        }
+
+        if (!this.commandFinished)
+        {
+            UnityEngine.Debug.LogError("[vlUnitySDK] Command '" + cmd.name +
+                "' wasn't processed");
+            return false;
+        }
+        if (this.commandError != null)
+        {
+            UnityEngine.Debug.LogError("[vlUnitySDK] Command '" + cmd.name +
+                "' failed: " + this.commandError);
+            return false;
+        }
+        return true;
+    }
+
+    /// <summary>
+    ///  Processes the frames of the image sequence.
+    /// </summary>
+    /// <returns>The measured results.</returns>
+    /// <param name="frameCount">
+    ///  Maximum number of frames. The replay stops earlier, if the worker
+    ///  fails to process a frame.
+    /// </param>
+    public Result Run(int frameCount)
+    {
+        Result result = new Result();
+        result.trackingConfig = this.trackingConfig;
+        result.imageSequence = this.imageSequence;
+
+        double[] latencies = new double[frameCount];
+        double millisecondsPerTick = 1000.0 / Stopwatch.Frequency;
+        int tracked = 0;
+        int critical = 0;
+        int lost = 0;
+        ulong hash = 14695981039346656037UL;
+
+        // Poses of the last two frames for computing the jitter
+        List<float[]> poses = new List<float[]>();
+        int lastPoseFrame = -1;
+        double translationSum = 0.0;
+        double rotationSum = 0.0;
+        int jitterSamples = 0;
+        double translationErrorSum = 0.0;
+        double rotationErrorSum = 0.0;
+        int evaluatedFrames = 0;
+
+        int frame = 0;
+        for (; frame < frameCount; ++frame)
+        {
+            this.frameState = VLTrackingStateInfo.State.Unknown;
+            this.frameHasPose = false;
+
+            long startTicks = Stopwatch.GetTimestamp();
+            bool success = this.worker.RunOnceSync();
+            this.worker.ProcessCallbacks();
+            this.worker.PollEvents();
+            latencies[frame] =
+                (Stopwatch.GetTimestamp() - startTicks) * millisecondsPerTick;
+            FlushLogBuffer();
+
+            if (!success)
+            {
+                break;
+            }
+
+            switch (this.frameState)
+            {
+                case VLTrackingStateInfo.State.Tracked:
+                    ++tracked;
+                    break;
+                case VLTrackingStateInfo.State.Critical:
+                    ++critical;
+                    break;
+                case VLTrackingStateInfo.State.Lost:
+                    ++lost;
+                    break;
+            }
+
+            hash = Hash(hash, (long)this.frameState);
+            if (this.frameHasPose)
+            {
+                for (int i = 0; i < 3; ++i)
+                {
+                    hash = Hash(hash, (long)Math.Round(this.frameT[i] * 1.0e4));
+                }
+                for (int i = 0; i < 4; ++i)
+                {
+                    hash = Hash(hash, (long)Math.Round(this.frameQ[i] * 1.0e4));
+                }
+            }
+
+            if (this.frameState != VLTrackingStateInfo.State.Tracked ||
+                !this.frameHasPose)
+            {
+                continue;
+            }
+
+            if (this.groundTruth != null &&
+                frame < this.groundTruth.poses.Length)
+            {
+                VLGroundTruth.Pose truth = this.groundTruth.poses[frame];
+                double squaredDistance = 0.0;
+                double dot = 0.0;
+                for (int i = 0; i < 3; ++i)
+                {
+                    double d = this.frameT[i] - truth.t[i];
+                    squaredDistance += d * d;
+                }
+                for (int i = 0; i < 4; ++i)
+                {
+                    dot += this.frameQ[i] * truth.q[i];
+                }
+                translationErrorSum += Math.Sqrt(squaredDistance);
+                rotationErrorSum += 2.0 * Math.Acos(Math.Min(1.0, Math.Abs(dot)));
+                ++evaluatedFrames;
+            }
+
+            float[] pose = new float[7];
+            Array.Copy(this.frameT, 0, pose, 0, 3);
+            Array.Copy(this.frameQ, 0, pose, 3, 4);
+            if (lastPoseFrame != frame - 1)
+            {
+                poses.Clear();
+            }
+            poses.Add(pose);
+            lastPoseFrame = frame;
+            if (poses.Count < 3)
+            {
+                continue;
+            }
+
+            float[] p0 = poses[0];
+            float[] p1 = poses[1];
+            float[] p2 = poses[2];
+            for (int i = 0; i < 3; ++i)
+            {
+                double d = p2[i] - 2.0 * p1[i] + p0[i];
+                translationSum += d * d;
+            }
+            double angle = GetRotationChangeAngle(p0, p1, p2);
+            rotationSum += angle * angle;
+            ++jitterSamples;
+            poses.RemoveAt(0);
+        }
+
+        result.frames = frame;
+        if (frame == 0)
+        {
+            return result;
+        }
+
+        double seconds = 0.0;
+        for (int i = 0; i < frame; ++i)
+        {
+            seconds += latencies[i] / 1000.0;
+        }
+        double[] sorted = new double[frame];
+        Array.Copy(latencies, sorted, frame);
+        Array.Sort(sorted);
+
+        result.seconds = seconds;
+        result.framesPerSecond = (seconds > 0.0 ? frame / seconds : 0.0);
+        result.latencyP50 = GetPercentile(sorted, 50.0);
+        result.latencyP95 = GetPercentile(sorted, 95.0);
+        result.latencyP99 = GetPercentile(sorted, 99.0);
+        result.latencyMax = sorted[frame - 1];
+        result.trackedRatio = (double)tracked / frame;
+        result.criticalRatio = (double)critical / frame;
+        result.lostRatio = (double)lost / frame;
+        if (jitterSamples > 0)
+        {
+            result.translationJitter = Math.Sqrt(translationSum / jitterSamples);
+            result.rotationJitter =
+                Math.Sqrt(rotationSum / jitterSamples) * 180.0 / Math.PI;
+        }
+        result.resultHash = hash.ToString("x16");
+        result.evaluatedFrames = evaluatedFrames;
+        if (evaluatedFrames > 0)
+        {
+            result.translationError = translationErrorSum / evaluatedFrames;
+            result.rotationError =
+                rotationErrorSum / evaluatedFrames * 180.0 / Math.PI;
+        }
+
+        return result;
+    }
+
+    private void FlushLogBuffer()
+    {
+        if (this.logger != null)
+        {
+            this.logger.FlushLogBuffer();
+        }
+    }
+
+    private void ExtrinsicDataHandler(IntPtr handle)
+    {
+        VLExtrinsicDataWrapper extrinsicData =
+            new VLExtrinsicDataWrapper(handle, false);
+        this.frameHasPose = extrinsicData.GetValid() &&
+            extrinsicData.GetT(this.frameT) && extrinsicData.GetR(this.frameQ);
+        extrinsicData.Dispose();
+    }
+
+    private void TrackingStateHandler(string trackingStateJson)
+    {
+        VLTrackingState state =
+            VLJsonUtility.FromJson<VLTrackingState>(trackingStateJson);
+        if (state != null && state.objects != null && state.objects.Length > 0)
+        {
+            this.frameState =
+                VLTrackingStateInfo.ParseState(state.objects[0].state);
+        }
+    }
+
+    private static double GetPercentile(double[] sorted, double percentile)
+    {
+        int rank = (int)Math.Ceiling(percentile / 100.0 * sorted.Length);
+        return sorted[Math.Max(0, Math.Min(rank - 1, sorted.Length - 1))];
+    }
+
+    private static ulong Hash(ulong hash, long value)
+    {
+        // FNV-1a over the bytes of the value
+        for (int i = 0; i < 8; ++i)
+        {
+            hash ^= (ulong)((value >> (8 * i)) & 0xff);
+            hash *= 1099511628211UL;
+        }
+        return hash;
+    }
+
+    /// <summary>
+    ///  Returns the angle of the change between the rotation from p0 to p1
+    ///  and the rotation from p1 to p2.
+    /// </summary>
+    private static double GetRotationChangeAngle(float[] p0, float[] p1,
+        float[] p2)
+    {
+        double[] r01 = Multiply(p1, 3, Conjugate(p0, 3));
+        double[] r12 = Multiply(p2, 3, Conjugate(p1, 3));
+        double[] q = new double[4];
+        double[] inv = new double[] { -r01[0], -r01[1], -r01[2], r01[3] };
+        // q = r12 * inv(r01)
+        q[0] = r12[3] * inv[0] + r12[0] * inv[3] + r12[1] * inv[2] - r12[2] * inv[1];
+        q[1] = r12[3] * inv[1] - r12[0] * inv[2] + r12[1] * inv[3] + r12[2] * inv[0];
+        q[2] = r12[3] * inv[2] + r12[0] * inv[1] - r12[1] * inv[0] + r12[2] * inv[3];
+        q[3] = r12[3] * inv[3] - r12[0] * inv[0] - r12[1] * inv[1] - r12[2] * inv[2];
+        double w = Math.Min(1.0, Math.Abs(q[3]) /
+            Math.Sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]));
+        return 2.0 * Math.Acos(w);
+    }
+
+    private static double[] Conjugate(float[] p, int offset)
+    {
+        return new double[]
+        {
+            -p[offset], -p[offset + 1], -p[offset + 2], p[offset + 3]
+        };
+    }
+
+    private static double[] Multiply(float[] p, int offset, double[] b)
+    {
+        double ax = p[offset];
+        double ay = p[offset + 1];
+        double az = p[offset + 2];
+        double aw = p[offset + 3];
+        return new double[]
+        {
+            aw * b[0] + ax * b[3] + ay * b[2] - az * b[1],
+            aw * b[1] - ax * b[2] + ay * b[3] + az * b[0],
+            aw * b[2] + ax * b[1] - ay * b[0] + az * b[3],
+            aw * b[3] - ax * b[0] - ay * b[1] - az * b[2]
+        };
+    }
+}
+
+/**@}*/
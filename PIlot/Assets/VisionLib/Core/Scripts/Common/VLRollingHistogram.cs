@@ -0,0 +1,279 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+
+/// <summary>
+///  Histogram of durations in microseconds over a rolling time window.
+/// </summary>
+/// <remarks>
+///  <para>
+///   Values are counted in logarithmic buckets with 16 linear sub-buckets
+///   per power of two. Percentiles are therefore reported with a relative
+///   error of at most 6.25%, while the memory stays constant regardless of
+///   the number of recorded values. The maximum is exact.
+///  </para>
+///  <para>
+///   The window is split into slices. Whenever a slice gets older than the
+///   window, its counts are discarded. All functions are thread-safe.
+///  </para>
+/// </remarks>
+public class VLRollingHistogram
+{
+    /// <summary>
+    ///  Percentiles of the values inside the window.
+    /// </summary>
+    public struct Summary
+    {
+        /// <summary>Number of values inside the window.</summary>
+        public long count;
+        /// <summary>Median in microseconds.</summary>
+        public long p50;
+        /// <summary>95th percentile in microseconds.</summary>
+        public long p95;
+        /// <summary>99th percentile in microseconds.</summary>
+        public long p99;
+        /// <summary>Maximum in microseconds.</summary>
+        public long max;
+    }
+
+    private const int subBucketBits = 4;
+    private const int subBucketCount = 1 << subBucketBits;
+    private const int maxMagnitude = 40;
+    private const long maxValue = (1L << (maxMagnitude + 1)) - 1;
+    private const int bucketCount =
+        subBucketCount * (maxMagnitude - subBucketBits + 2);
+
+    private readonly object lockObject = new object();
+    private readonly double sliceDuration;
+    private readonly int[][] sliceCounts;
+    private readonly long[] sliceTotals;
+    private readonly long[] sliceMaxima;
+    private readonly long[] mergedCounts = new long[bucketCount];
+    private long currentSlice = 0;
+    private bool empty = true;
+
+    /// <summary>
+    ///  Creates a new histogram.
+    /// </summary>
+    /// <param name="windowSeconds">
+    ///  Duration of the rolling window in seconds.
+    /// </param>
+    /// <param name="sliceCount">
+    ///  Number of slices the window is split into. More slices let values
+    ///  expire more smoothly.
+    /// </param>
+    public VLRollingHistogram(double windowSeconds = 10.0, int sliceCount = 10)
+    {
+        if (windowSeconds <= 0.0)
+        {
+            throw new ArgumentOutOfRangeException("windowSeconds");
+        }
+        if (sliceCount < 1)
+        {
+            throw new ArgumentOutOfRangeException("sliceCount");
+        }
+
+        this.sliceDuration = windowSeconds / sliceCount;
+        this.sliceCounts = new int[sliceCount][];
+        for (int i = 0; i < sliceCount; ++i)
+        {
+            this.sliceCounts[i] = new int[bucketCount];
+        }
+        this.sliceTotals = new long[sliceCount];
+        this.sliceMaxima = new long[sliceCount];
+    }
+
+    /// <summary>
+    ///  Records a value at the current time.
+    /// </summary>
+    /// <param name="microseconds">Duration in microseconds.</param>
+    public void Record(long microseconds)
+    {
+        Record(microseconds, VLFrameClock.GetTime());
+    }
+
+    /// <summary>
+    ///  Records a value at the given time.
+    /// </summary>
+    /// <param name="microseconds">Duration in microseconds.</param>
+    /// <param name="time">
+    ///  Time in seconds of the <see cref="VLFrameClock"/>.
+    /// </param>
+    public void Record(long microseconds, double time)
+    {
+        long value = Math.Max(0, Math.Min(microseconds, maxValue));
+        lock (this.lockObject)
+        {
+            int slice = Advance(time);
+            ++this.sliceCounts[slice][GetBucketIndex(value)];
+            ++this.sliceTotals[slice];
+            if (value > this.sliceMaxima[slice])
+            {
+                this.sliceMaxima[slice] = value;
+            }
+        }
+    }
+
+    /// <summary>
+    ///  Returns the given percentile of the values inside the window.
+    /// </summary>
+    /// <returns>
+    ///  The percentile in microseconds or 0, if the window is empty.
+    /// </returns>
+    /// <param name="percentile">Percentile between 0 and 100.</param>
+    public long GetPercentile(double percentile)
+    {
+        lock (this.lockObject)
+        {
+            long max;
+            long count = Merge(VLFrameClock.GetTime(), out max);
+            return GetPercentile(percentile, count, max);
+        }
+    }
+
+    /// <summary>
+    ///  Returns the median, the 95th and 99th percentile and the maximum of
+    ///  the values inside the window.
+    /// </summary>
+    public Summary GetSummary()
+    {
+        lock (this.lockObject)
+        {
+            Summary summary;
+            summary.count = Merge(VLFrameClock.GetTime(), out summary.max);
+            summary.p50 = GetPercentile(50.0, summary.count, summary.max);
+            summary.p95 = GetPercentile(95.0, summary.count, summary.max);
+            summary.p99 = GetPercentile(99.0, summary.count, summary.max);
+            return summary;
+        }
+    }
+
+    /// <summary>
+    ///  Discards all recorded values.
+    /// </summary>
+    public void Reset()
+    {
+        lock (this.lockObject)
+        {
+            this.empty = true;
+            for (int i = 0; i < this.sliceCounts.Length; ++i)
+            {
+                ClearSlice(i);
+            }
+        }
+    }
+
+    private static int GetBucketIndex(long value)
+    {
+        if (value < subBucketCount)
+        {
+            return (int)value;
+        }
+
+        int magnitude = 0;
+        for (long v = value >> (subBucketBits + 1); v != 0; v >>= 1)
+        {
+            ++magnitude;
+        }
+        int subBucket = (int)(value >> magnitude) - subBucketCount;
+        return subBucketCount + magnitude * subBucketCount + subBucket;
+    }
+
+    private static long GetBucketUpperBound(int index)
+    {
+        if (index < subBucketCount)
+        {
+            return index;
+        }
+
+        int magnitude = (index - subBucketCount) / subBucketCount;
+        int subBucket = (index - subBucketCount) % subBucketCount;
+        long lowerBound = (long)(subBucketCount + subBucket) << magnitude;
+        return lowerBound + (1L << magnitude) - 1;
+    }
+
+    private void ClearSlice(int slice)
+    {
+        Array.Clear(this.sliceCounts[slice], 0, bucketCount);
+        this.sliceTotals[slice] = 0;
+        this.sliceMaxima[slice] = 0;
+    }
+
+    /// <summary>
+    ///  Discards all slices, which are older than the window, and returns
+    ///  the index of the slice for the given time.
+    /// </summary>
+    private int Advance(double time)
+    {
+        int sliceCount = this.sliceCounts.Length;
+        long slice = (long)Math.Floor(time / this.sliceDuration);
+        if (this.empty)
+        {
+            this.currentSlice = slice;
+            this.empty = false;
+        }
+        else if (slice > this.currentSlice)
+        {
+            long steps = Math.Min(slice - this.currentSlice, sliceCount);
+            for (long i = 1; i <= steps; ++i)
+            {
+                ClearSlice((int)((this.currentSlice + i) % sliceCount));
+            }
+            this.currentSlice = slice;
+        }
+
+        // Values from the past are added to the current slice
+        return (int)(this.currentSlice % sliceCount);
+    }
+
+    private long Merge(double time, out long max)
+    {
+        Advance(time);
+
+        Array.Clear(this.mergedCounts, 0, bucketCount);
+        long count = 0;
+        max = 0;
+        for (int s = 0; s < this.sliceCounts.Length; ++s)
+        {
+            if (this.sliceTotals[s] == 0)
+            {
+                continue;
+            }
+            int[] counts = this.sliceCounts[s];
+            for (int i = 0; i < bucketCount; ++i)
+            {
+                this.mergedCounts[i] += counts[i];
+            }
+            count += this.sliceTotals[s];
+            max = Math.Max(max, this.sliceMaxima[s]);
+        }
+
+        return count;
+    }
+
+    private long GetPercentile(double percentile, long count, long max)
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        double fraction = Math.Max(0.0, Math.Min(percentile, 100.0)) / 100.0;
+        long rank = Math.Max(1, (long)Math.Ceiling(fraction * count));
+        long accumulated = 0;
+        for (int i = 0; i < bucketCount; ++i)
+        {
+            accumulated += this.mergedCounts[i];
+            if (accumulated >= rank)
+            {
+                return Math.Min(GetBucketUpperBound(i), max);
+            }
+        }
+
+        return max;
+    }
+}
+
+/**@}*/
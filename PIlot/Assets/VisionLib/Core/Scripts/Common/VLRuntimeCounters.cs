@@ -0,0 +1,94 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+
+/// <summary>
+///  Snapshot of the counters and gauges of the tracking runtime.
+/// </summary>
+/// <remarks>
+///  <para>
+///   Counters are monotonic since the VLWorkerBehaviour was created and
+///   can be turned into rates by comparing two snapshots. Gauges describe
+///   the state at the time of the snapshot.
+///  </para>
+///  <para>
+///   Everything is measured on the Unity side of the VisionLib. Frames,
+///   which are dropped inside the tracking thread, and the memory held by
+///   the native models and init data are not visible there.
+///  </para>
+/// </remarks>
+/// <seealso cref="VLWorkerBehaviour.GetRuntimeCounters"/>
+[Serializable]
+public struct VLRuntimeCounters
+{
+    /// <summary>
+    ///  Monotonic time in seconds at which the snapshot was taken.
+    /// </summary>
+    /// <seealso cref="VLFrameClock.GetTime"/>
+    public double timestamp;
+
+    /// <summary>Number of frames received from the tracking thread.</summary>
+    public long framesReceived;
+
+    /// <summary>Number of frames with a tracking state.</summary>
+    public long framesProcessed;
+
+    /// <summary>
+    ///  Number of frames, in which at least one object had the tracking
+    ///  state "tracked" or "critical".
+    /// </summary>
+    public long framesTracked;
+
+    /// <summary>
+    ///  Number of images, which were replaced by a newer image before they
+    ///  could be delivered to the LatestOnly image listeners.
+    /// </summary>
+    public long imagesSkipped;
+
+    /// <summary>Number of commands enqueued for the tracking thread.</summary>
+    public long commandsPushed;
+
+    /// <summary>Number of commands whose callback was called.</summary>
+    public long commandsProcessed;
+
+    /// <summary>Number of polls for events.</summary>
+    public long eventPolls;
+
+    /// <summary>Number of events received.</summary>
+    public long eventsReceived;
+
+    /// <summary>Number of image buffers allocated.</summary>
+    public long imageBufferAllocations;
+
+    /// <summary>
+    ///  Number of garbage collections of the youngest generation.
+    /// </summary>
+    public long garbageCollections;
+
+    /// <summary>
+    ///  Number of commands waiting to be processed or for their callback.
+    /// </summary>
+    public int pendingCommands;
+
+    /// <summary>Number of events received by the last poll.</summary>
+    public int eventsLastPoll;
+
+    /// <summary>Highest number of events received by a single poll.</summary>
+    public int eventsMaxPoll;
+
+    /// <summary>
+    ///  Number of templates of all tracked objects reported with the last
+    ///  tracking state.
+    /// </summary>
+    public int numberOfTemplates;
+
+    /// <summary>Bytes held by the image buffers of the image pool.</summary>
+    public long imageBytes;
+
+    /// <summary>Bytes currently allocated on the managed heap.</summary>
+    public long managedHeapBytes;
+}
+
+/**@}*/
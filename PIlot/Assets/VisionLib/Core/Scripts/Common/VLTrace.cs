@@ -0,0 +1,368 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using System.Text;
+using System.Threading;
+
+/// <summary>
+///  Records spans of the execution of the VisionLib in the Chrome trace
+///  event format.
+/// </summary>
+/// <remarks>
+///  <para>
+///   Tracing is disabled by default. While it is disabled, creating a span
+///   only costs a single check. After calling <see cref="Start"/>, each
+///   thread records its spans into its own buffer without any locking. The
+///   buffers have a fixed capacity and further spans are dropped once a
+///   buffer is full.
+///  </para>
+///  <para>
+///   The recorded trace can be written using <see cref="WriteChromeTrace"/>
+///   and viewed in Perfetto (https://ui.perfetto.dev) or chrome://tracing.
+///  </para>
+///  <para>
+///   Spans are created like this:
+///   <code>
+///    using (VLTrace.BeginSpan("PollEvents"))
+///    {
+///        this.worker.PollEvents();
+///    }
+///   </code>
+///  </para>
+/// </remarks>
+public static class VLTrace
+{
+    /// <summary>
+    ///  Span, which is recorded when it gets disposed.
+    /// </summary>
+    public struct Span : IDisposable
+    {
+        private readonly string name;
+        private readonly string argument;
+        private readonly long startTicks;
+
+        internal Span(string name, string argument)
+        {
+            this.name = name;
+            this.argument = argument;
+            this.startTicks = Stopwatch.GetTimestamp();
+        }
+
+        /// <summary>
+        ///  Ends the span and records it.
+        /// </summary>
+        public void Dispose()
+        {
+            if (this.name != null)
+            {
+                Record(this.name, this.argument, this.startTicks,
+                    Stopwatch.GetTimestamp());
+            }
+        }
+    }
+
+    private class ThreadBuffer
+    {
+        public readonly int threadId;
+        public readonly string threadName;
+        public int generation = -1;
+        public string[] names;
+        public string[] arguments;
+        public long[] startTicks;
+        public long[] endTicks;
+        public int count;
+        public int dropped;
+
+        public ThreadBuffer()
+        {
+            Thread thread = Thread.CurrentThread;
+            this.threadId = thread.ManagedThreadId;
+            this.threadName = thread.Name;
+        }
+    }
+
+    private const string category = "vlUnitySDK";
+
+    private static readonly double microsecondsPerTick =
+        1.0e6 / Stopwatch.Frequency;
+
+    [ThreadStatic]
+    private static ThreadBuffer threadBuffer;
+
+    private static readonly object lockObject = new object();
+    private static readonly List<ThreadBuffer> buffers =
+        new List<ThreadBuffer>();
+    private static volatile bool enabled = false;
+    private static volatile int generation = 0;
+    private static int capacity = 0;
+    private static long originTicks = 0;
+
+    /// <summary>
+    ///  Returns whether spans are currently recorded.
+    /// </summary>
+    public static bool IsEnabled()
+    {
+        return enabled;
+    }
+
+    /// <summary>
+    ///  Discards the previous trace and starts recording spans.
+    /// </summary>
+    /// <param name="spansPerThread">
+    ///  Maximum number of spans recorded per thread.
+    /// </param>
+    public static void Start(int spansPerThread = 65536)
+    {
+        if (spansPerThread < 1)
+        {
+            throw new ArgumentOutOfRangeException("spansPerThread");
+        }
+
+        lock (lockObject)
+        {
+            enabled = false;
+            buffers.Clear();
+            capacity = spansPerThread;
+            originTicks = Stopwatch.GetTimestamp();
+            ++generation;
+            enabled = true;
+        }
+    }
+
+    /// <summary>
+    ///  Stops recording spans. The recorded trace is kept.
+    /// </summary>
+    public static void Stop()
+    {
+        enabled = false;
+    }
+
+    /// <summary>
+    ///  Begins a span, which ends when it gets disposed.
+    /// </summary>
+    /// <param name="name">
+    ///  Name of the span. Should be a constant string to avoid allocations.
+    /// </param>
+    /// <param name="argument">
+    ///  Optional argument shown with the span, e.g. the name of a command.
+    /// </param>
+    public static Span BeginSpan(string name, string argument = null)
+    {
+        if (!enabled)
+        {
+            return new Span();
+        }
+        return new Span(name, argument);
+    }
+
+    private static void Record(string name, string argument,
+        long startTicks, long endTicks)
+    {
+        ThreadBuffer buffer = GetThreadBuffer();
+        if (buffer == null)
+        {
+            return;
+        }
+
+        int index = buffer.count;
+        if (index >= buffer.names.Length)
+        {
+            ++buffer.dropped;
+            return;
+        }
+        buffer.names[index] = name;
+        buffer.arguments[index] = argument;
+        buffer.startTicks[index] = startTicks;
+        buffer.endTicks[index] = endTicks;
+
+        // Publish the span after it was written completely
+        Volatile.Write(ref buffer.count, index + 1);
+    }
+
+    private static ThreadBuffer GetThreadBuffer()
+    {
+        ThreadBuffer buffer = threadBuffer;
+        if (buffer != null && buffer.generation == generation)
+        {
+            return buffer;
+        }
+
+        // First span of this thread since the trace was started
+        lock (lockObject)
+        {
+            if (!enabled)
+            {
+                return null;
+            }
+            if (buffer == null)
+            {
+                buffer = new ThreadBuffer();
+                threadBuffer = buffer;
+            }
+            if (buffer.names == null || buffer.names.Length != capacity)
+            {
+                buffer.names = new string[capacity];
+                buffer.arguments = new string[capacity];
+                buffer.startTicks = new long[capacity];
+                buffer.endTicks = new long[capacity];
+            }
+            buffer.count = 0;
+            buffer.dropped = 0;
+            buffer.generation = generation;
+            buffers.Add(buffer);
+        }
+
+        return buffer;
+    }
+
+    /// <summary>
+    ///  Returns the number of spans, which were dropped, because a buffer
+    ///  was full.
+    /// </summary>
+    public static int GetDroppedSpanCount()
+    {
+        lock (lockObject)
+        {
+            int dropped = 0;
+            foreach (ThreadBuffer buffer in buffers)
+            {
+                dropped += buffer.dropped;
+            }
+            return dropped;
+        }
+    }
+
+    /// <summary>
+    ///  Returns the recorded trace as JSON in the Chrome trace event format.
+    /// </summary>
+    public static string ToChromeTraceJson()
+    {
+        StringBuilder json = new StringBuilder();
+        json.Append("{\"traceEvents\":[");
+
+        bool first = true;
+        lock (lockObject)
+        {
+            foreach (ThreadBuffer buffer in buffers)
+            {
+                AppendSeparator(json, ref first);
+                json.Append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":");
+                json.Append(buffer.threadId);
+                json.Append(",\"args\":{\"name\":");
+                AppendString(json, buffer.threadName != null ?
+                    buffer.threadName : "Thread " + buffer.threadId);
+                json.Append("}}");
+
+                int count = Volatile.Read(ref buffer.count);
+                for (int i = 0; i < count; ++i)
+                {
+                    AppendSeparator(json, ref first);
+                    json.Append("{\"name\":");
+                    AppendString(json, buffer.names[i]);
+                    json.Append(",\"cat\":\"" + category + "\",\"ph\":\"X\",\"ts\":");
+                    AppendMicroseconds(json,
+                        buffer.startTicks[i] - originTicks);
+                    json.Append(",\"dur\":");
+                    AppendMicroseconds(json,
+                        buffer.endTicks[i] - buffer.startTicks[i]);
+                    json.Append(",\"pid\":1,\"tid\":");
+                    json.Append(buffer.threadId);
+                    if (buffer.arguments[i] != null)
+                    {
+                        json.Append(",\"args\":{\"argument\":");
+                        AppendString(json, buffer.arguments[i]);
+                        json.Append("}");
+                    }
+                    json.Append("}");
+                }
+            }
+        }
+
+        json.Append("],\"displayTimeUnit\":\"ms\"}");
+        return json.ToString();
+    }
+
+    /// <summary>
+    ///  Writes the recorded trace to a file.
+    /// </summary>
+    /// <returns>
+    ///  <c>true</c>, if the file was written successfully;
+    ///  <c>false</c> otherwise.
+    /// </returns>
+    /// <param name="path">Path of the JSON file.</param>
+    public static bool WriteChromeTrace(string path)
+    {
+        try
+        {
+            File.WriteAllText(path, ToChromeTraceJson());
+        }
+        catch (Exception e)
+        {
+            UnityEngine.Debug.LogError("[vlUnitySDK] Could not write trace to '" +
+                path + "': " + e.Message);
+            return false;
+        }
+
+        return true;
+    }
+
+    private static void AppendSeparator(StringBuilder json, ref bool first)
+    {
+        if (!first)
+        {
+            json.Append(",\n");
+        }
+        first = false;
+    }
+
+    private static void AppendMicroseconds(StringBuilder json, long ticks)
+    {
+        json.Append((ticks * microsecondsPerTick).ToString(
+            "0.###", CultureInfo.InvariantCulture));
+    }
+
+    private static void AppendString(StringBuilder json, string value)
+    {
+        json.Append('"');
+        foreach (char c in value)
+        {
+            switch (c)
+            {
+                case '"':
+                    json.Append("\\\"");
+                    break;
+                case '\\':
+                    json.Append("\\\\");
+                    break;
+                case '\n':
+                    json.Append("\\n");
+                    break;
+                case '\r':
+                    json.Append("\\r");
+                    break;
+                case '\t':
+                    json.Append("\\t");
+                    break;
+                default:
+                    if (c < ' ')
+                    {
+                        json.AppendFormat("\\u{0:x4}", (int)c);
+                    }
+                    else
+                    {
+                        json.Append(c);
+                    }
+                    break;
+            }
+        }
+        json.Append('"');
+    }
+}
+
+/**@}*/
@@ -21,16 +21,41 @@ public class VLTrackingCameraBehaviour : VLWorkerReferenceBehaviour
     /// </remarks>
     public int backgroundLayer = 8;
 
+    /// <summary>
+    ///  Extrapolate the camera pose to the time of rendering.
+    /// </summary>
+    /// <remarks>
+    ///  This hides the tracking latency while the camera or the tracked
+    ///  object is moving, but might overshoot on sudden stops.
+    /// </remarks>
+    [Tooltip("Extrapolate the camera pose to the time of rendering in order to hide the tracking latency.")]
+    public bool predictPose = false;
+
+    /// <summary>
+    ///  Latency in seconds between the update and the display of a frame,
+    ///  which will be added to the extrapolation.
+    /// </summary>
+    /// <remarks>
+    ///  The poses are extrapolated from the capture time of their image, so
+    ///  the processing latency of the tracking is already included.
+    /// </remarks>
+    [Tooltip("Latency in seconds between the update and the display of a frame, which will be added to the extrapolation.")]
+    public float predictionLatency = 0.03f;
+
     private Camera trackingCamera;
 
     private Matrix4x4 rotCamera = VLUnityCameraHelper.rotationZ0;
     private VLRenderRotation renderRotation = VLRenderRotation.CCW0;
 
     private float[] modelViewMatrixArray = new float[16];
+    private float[] predictedModelViewMatrixArray = new float[16];
+    private bool modelViewMatrixValid = false;
     private Matrix4x4 modelViewMatrix = new Matrix4x4();
     private float[] projectionMatrixArray = new float[16];
     private Matrix4x4 projectionMatrix = new Matrix4x4();
 
+    private VLPosePredictor posePredictor = new VLPosePredictor();
+
     private void OnExtrinsicData(VLExtrinsicDataWrapper extrinsicData)
     {
         if (!extrinsicData.GetModelViewMatrix(this.modelViewMatrixArray) || !this.InitWorkerReference())
@@ -38,12 +63,35 @@ public class VLTrackingCameraBehaviour : VLWorkerReferenceBehaviour
             return;
         }
 
+        // The pose is added to the history, once the capture time of the
+        // frame arrives with the tracking states. The camera is only moved in
+        // LateUpdate, so each rendered frame uses either the predicted or
+        // the raw pose.
+        this.modelViewMatrixValid = true;
+        if (this.predictPose)
+        {
+            this.posePredictor.AddSample(extrinsicData);
+        }
+    }
+
+    private void OnTrackingStates(VLTrackingState state)
+    {
+        if (this.predictPose && this.InitWorkerReference() &&
+            this.workerBehaviour.GetFrameClock().HasCaptureTime())
+        {
+            this.posePredictor.SetCaptureTime(state.frameIndex,
+                state.frameTimestamp);
+        }
+    }
+
+    private void ApplyModelViewMatrix(float[] modelViewMatrixArray)
+    {
         // Apply the extrinsic camera parameters
 
         for (int i=0; i < 16; ++i)
         {
             this.modelViewMatrix[i % 4, i / 4] =
-                this.modelViewMatrixArray[i];
+                modelViewMatrixArray[i];
         }
         /*
         // TODO(mbuchner): Why is this necessary? According to the Unity
@@ -131,13 +179,18 @@ public class VLTrackingCameraBehaviour : VLWorkerReferenceBehaviour
 
         VLWorkerBehaviour.OnExtrinsicData += OnExtrinsicData;
         VLWorkerBehaviour.OnIntrinsicData += OnIntrinsicData;
+        VLWorkerBehaviour.OnTrackingStates += OnTrackingStates;
     }
 
     private void OnDisable()
     {
+        VLWorkerBehaviour.OnTrackingStates -= OnTrackingStates;
         VLWorkerBehaviour.OnIntrinsicData -= OnIntrinsicData;
         VLWorkerBehaviour.OnExtrinsicData -= OnExtrinsicData;
         VLDetectScreenChangeBehaviour.OnOrientationChange -= OnOrientationChange;
+
+        this.posePredictor.Reset();
+        this.modelViewMatrixValid = false;
     }
 
     private void Start()
@@ -149,8 +202,26 @@ public class VLTrackingCameraBehaviour : VLWorkerReferenceBehaviour
 
     }
 
-    private void Update()
+    private void LateUpdate()
     {
+        if (!this.modelViewMatrixValid || !this.InitWorkerReference())
+        {
+            return;
+        }
+
+        // Without history (e.g. before the first capture time) the latest
+        // pose is used unchanged
+        if (this.predictPose &&
+            this.posePredictor.Predict(
+                VLFrameClock.GetTime() + this.predictionLatency,
+                this.predictedModelViewMatrixArray))
+        {
+            ApplyModelViewMatrix(this.predictedModelViewMatrixArray);
+        }
+        else
+        {
+            ApplyModelViewMatrix(this.modelViewMatrixArray);
+        }
     }
 }
 
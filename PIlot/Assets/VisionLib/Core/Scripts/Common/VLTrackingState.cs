@@ -67,5 +67,29 @@ public class VLTrackingState
     ///  Array with the tracking state of all tracking objects.
     /// </summary>
     public TrackingObject[] objects;
+
+    /// <summary>
+    ///  Index of the frame these tracking states belong to.
+    /// </summary>
+    /// <seealso cref="VLFrameClock"/>
+    [NonSerialized]
+    public long frameIndex = -1;
+
+    /// <summary>
+    ///  Capture time in seconds of the frame these tracking states belong
+    ///  to. In contrast to <see cref="TrackingObject.timeStamp"/> it's
+    ///  measured by the monotonic clock.
+    /// </summary>
+    /// <seealso cref="VLFrameClock.GetFrameTimestamp"/>
+    [NonSerialized]
+    public double frameTimestamp = 0.0;
+
+    /// <summary>
+    ///  Time in seconds of the monotonic clock, at which the frame arrived
+    ///  in Unity.
+    /// </summary>
+    /// <seealso cref="VLFrameClock.GetFrameArrivalTime"/>
+    [NonSerialized]
+    public double frameArrivalTime = 0.0;
 }
 /**@}*/
\ No newline at end of file
@@ -0,0 +1,171 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+
+/// <summary>
+///  VLTrackingStateInfo stores the tracking state and the quality metrics of
+///  one tracked object in a fixed layout.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The tracking state string is only mapped to <see cref="State"/> once
+///   per frame inside the VLWorkerBehaviour. Listeners of
+///   <see cref="VLWorkerBehaviour.OnTrackingStateInfo"/> can therefore
+///   compare the state without any string comparisons.
+///  </para>
+///  <para>
+///   The VisionLib still delivers the tracking states as JSON string. The
+///   string is parsed once and shared by all listeners.
+///  </para>
+/// </remarks>
+public struct VLTrackingStateInfo
+{
+    /// <summary>
+    ///  Tracking state of a tracked object.
+    /// </summary>
+    public enum State
+    {
+        /// <summary>No tracking state was received yet.</summary>
+        Unknown = 0,
+        /// <summary>Object was tracked successful.</summary>
+        Tracked = 1,
+        /// <summary>
+        ///  Object was tracked, but something disturbs the tracking.
+        /// </summary>
+        Critical = 2,
+        /// <summary>Object could not be tracked.</summary>
+        Lost = 3
+    };
+
+    /// <summary>Name of the tracking object.</summary>
+    public string name;
+
+    /// <summary>Tracking state.</summary>
+    public State state;
+
+    /// <summary>
+    ///  Quality value between 0.0 (worst quality) and 1.0 (best quality).
+    /// </summary>
+    public float quality;
+
+    /// <summary>
+    ///  Ratio between 0.0 and 1.0 of the correspondences, which were
+    ///  inliers during the initialization.
+    /// </summary>
+    public float initInlierRatio;
+
+    /// <summary>
+    ///  Number of correspondences found during the initialization.
+    /// </summary>
+    public int initNumOfCorresp;
+
+    /// <summary>
+    ///  Ratio between 0.0 and 1.0 of the correspondences, which were
+    ///  inliers during the tracking.
+    /// </summary>
+    public float trackingInlierRatio;
+
+    /// <summary>
+    ///  Number of correspondences found during the tracking.
+    /// </summary>
+    public int trackingNumOfCorresp;
+
+    /// <summary>
+    ///  Number of templates stored for the re-initialization of this
+    ///  object.
+    /// </summary>
+    public int numberOfTemplates;
+
+    /// <summary>
+    ///  The timestamp in seconds from 1.1.1970 at which the processing of
+    ///  the image has been started.
+    /// </summary>
+    public double timeStamp;
+
+    /// <summary>
+    ///  Index of the frame this tracking state belongs to.
+    /// </summary>
+    /// <seealso cref="VLFrameClock"/>
+    public long frameIndex;
+
+    /// <summary>
+    ///  Capture time in seconds of the frame this tracking state belongs to
+    ///  measured by the monotonic clock.
+    /// </summary>
+    /// <seealso cref="VLFrameClock.GetFrameTimestamp"/>
+    public double frameTimestamp;
+
+    /// <summary>
+    ///  Maps a tracking state string of the VisionLib to a
+    ///  <see cref="State"/>.
+    /// </summary>
+    /// <returns>
+    ///  The corresponding <see cref="State"/> or <see cref="State.Unknown"/>,
+    ///  if the string is not a known tracking state.
+    /// </returns>
+    /// <param name="state">
+    ///  "tracked", "critical" or "lost".
+    /// </param>
+    public static State ParseState(string state)
+    {
+        switch (state)
+        {
+            case "tracked":
+                return State.Tracked;
+            case "critical":
+                return State.Critical;
+            case "lost":
+                return State.Lost;
+            default:
+                return State.Unknown;
+        }
+    }
+
+    /// <summary>
+    ///  Returns the tracking state string of the VisionLib for a
+    ///  <see cref="State"/>.
+    /// </summary>
+    public static string GetStateString(State state)
+    {
+        switch (state)
+        {
+            case State.Tracked:
+                return "tracked";
+            case State.Critical:
+                return "critical";
+            case State.Lost:
+                return "lost";
+            default:
+                return "";
+        }
+    }
+
+    /// <summary>
+    ///  Creates a VLTrackingStateInfo from a parsed tracking object.
+    /// </summary>
+    /// <param name="obj">Parsed tracking object.</param>
+    /// <param name="frameIndex">Index of the frame.</param>
+    /// <param name="frameTimestamp">Timestamp of the frame.</param>
+    public static VLTrackingStateInfo FromTrackingObject(
+        VLTrackingState.TrackingObject obj, long frameIndex,
+        double frameTimestamp)
+    {
+        VLTrackingStateInfo info;
+        info.name = obj.name;
+        info.state = ParseState(obj.state);
+        info.quality = obj.quality;
+        info.initInlierRatio = obj._InitInlierRatio;
+        info.initNumOfCorresp = obj._InitNumOfCorresp;
+        info.trackingInlierRatio = obj._TrackingInlierRatio;
+        info.trackingNumOfCorresp = obj._TrackingNumOfCorresp;
+        info.numberOfTemplates = obj._NumberOfTemplates;
+        info.timeStamp = obj.timeStamp;
+        info.frameIndex = frameIndex;
+        info.frameTimestamp = frameTimestamp;
+        return info;
+    }
+}
+
+/**@}*/
@@ -204,6 +204,25 @@ public class VLWorkerBehaviour : MonoBehaviour
     /// </summary>
     public static event TrackingStatesAction OnTrackingStates;
 
+    /// <summary>
+    ///  Delegate for <see cref="OnTrackingStateInfo"/> events.
+    /// </summary>
+    /// <param name="info">
+    ///  <see cref="VLTrackingStateInfo"/> with the tracking state and the
+    ///  quality metrics of one tracked object.
+    /// </param>
+    public delegate void TrackingStateInfoAction(VLTrackingStateInfo info);
+    /// <summary>
+    ///  Event with the tracking state of one tracked object. This Event will
+    ///  be emitted for each tracked object in each tracking frame.
+    /// </summary>
+    /// <remarks>
+    ///  In contrast to <see cref="OnTrackingStates"/>, the tracking state is
+    ///  provided as enum, which makes string comparisons in the listeners
+    ///  unnecessary.
+    /// </remarks>
+    public static event TrackingStateInfoAction OnTrackingStateInfo;
+
     /// <summary>
     ///  Delegate for <see cref="OnPerformanceInfo"/> events.
     /// </summary>
@@ -226,6 +245,163 @@ public class VLWorkerBehaviour : MonoBehaviour
     public delegate void IntrinsicDataAction(VLIntrinsicDataWrapper intrinsicData);
     public static event IntrinsicDataAction OnIntrinsicData;
 
+    /// <summary>
+    ///  Delegate for <see cref="OnFrameResult"/> events.
+    /// </summary>
+    /// <param name="frameResult">
+    ///  <see cref="VLFrameResult"/> with all results of one frame.
+    /// </param>
+    public delegate void FrameResultAction(VLFrameResult frameResult);
+    /// <summary>
+    ///  Event with the image, the extrinsic and intrinsic data and the
+    ///  tracking states of one frame. This event will be emitted once for
+    ///  each tracking frame, after all results of the frame have been
+    ///  received.
+    /// </summary>
+    /// <remarks>
+    ///  Listening to this event is an alternative to listening to
+    ///  <see cref="OnImage"/>, <see cref="OnExtrinsicData"/>,
+    ///  <see cref="OnIntrinsicData"/> and <see cref="OnTrackingStates"/>
+    ///  separately, which guarantees that pose and image belong together.
+    /// </remarks>
+    public static event FrameResultAction OnFrameResult;
+
+    /// <summary>
+    ///  Delegate for <see cref="OnFrameTiming"/> events.
+    /// </summary>
+    /// <param name="timing">
+    ///  <see cref="VLFrameTiming"/> with the durations of the processing
+    ///  stages of one frame.
+    /// </param>
+    public delegate void FrameTimingAction(VLFrameTiming timing);
+    /// <summary>
+    ///  Event with the durations of the processing stages of one frame. This
+    ///  event will be emitted once for each tracking frame, after all
+    ///  results of the frame have been dispatched.
+    /// </summary>
+    public static event FrameTimingAction OnFrameTiming;
+
+    private static VLPerformanceStatistics performanceStatistics =
+        new VLPerformanceStatistics();
+
+    /// <summary>
+    ///  Returns the rolling statistics of the frame timings.
+    /// </summary>
+    /// <remarks>
+    ///  The statistics can be queried at any time and from any thread.
+    /// </remarks>
+    public static VLPerformanceStatistics GetPerformanceStatistics()
+    {
+        return performanceStatistics;
+    }
+
+    private static VLPosePublisher latestPose = new VLPosePublisher();
+
+    /// <summary>
+    ///  Returns the publisher of the most recent camera pose.
+    /// </summary>
+    /// <remarks>
+    ///  The pose can be read from any thread without waiting for the
+    ///  <see cref="OnExtrinsicData"/> event.
+    /// </remarks>
+    public static VLPosePublisher GetLatestPose()
+    {
+        return latestPose;
+    }
+
+    private static VLCoalescingEvent<VLImageWrapper> imageEvent =
+        new VLCoalescingEvent<VLImageWrapper>(
+            image => image.Retain(),
+            image => image.Release());
+    private static VLCoalescingEvent<VLExtrinsicDataWrapper> extrinsicDataEvent =
+        new VLCoalescingEvent<VLExtrinsicDataWrapper>(
+            extrinsicData => extrinsicData.CreateSnapshot(),
+            extrinsicData => extrinsicData.Dispose());
+    private static VLCoalescingEvent<VLTrackingState> trackingStatesEvent =
+        new VLCoalescingEvent<VLTrackingState>(
+            state => state,
+            state => {});
+
+    /// <summary>
+    ///  Adds a listener for images with the given delivery policy.
+    /// </summary>
+    /// <remarks>
+    ///  In contrast to <see cref="OnImage"/>, the listener can skip images.
+    ///  With <see cref="VLDeliveryPolicy.LatestOnly"/> the listener only
+    ///  receives the newest image once per Update, even if several images
+    ///  were queued (e.g. after loading a scene). The image is valid during
+    ///  the call.
+    /// </remarks>
+    /// <param name="listener">Listener, which will receive the images.</param>
+    /// <param name="policy">Delivery policy of the listener.</param>
+    public static void AddImageListener(ImageAction listener,
+        VLDeliveryPolicy policy)
+    {
+        imageEvent.Add(listener, new Action<VLImageWrapper>(listener), policy);
+    }
+
+    /// <summary>
+    ///  Removes a listener added with <see cref="AddImageListener"/>.
+    /// </summary>
+    /// <param name="listener">Listener, which was added before.</param>
+    public static void RemoveImageListener(ImageAction listener)
+    {
+        imageEvent.Remove(listener);
+    }
+
+    /// <summary>
+    ///  Adds a listener for extrinsic data with the given delivery policy.
+    /// </summary>
+    /// <remarks>
+    ///  See <see cref="AddImageListener"/>. LatestOnly listeners receive a
+    ///  read-only snapshot of the extrinsic data.
+    /// </remarks>
+    /// <param name="listener">
+    ///  Listener, which will receive the extrinsic data.
+    /// </param>
+    /// <param name="policy">Delivery policy of the listener.</param>
+    public static void AddExtrinsicDataListener(ExtrinsicDataAction listener,
+        VLDeliveryPolicy policy)
+    {
+        extrinsicDataEvent.Add(listener,
+            new Action<VLExtrinsicDataWrapper>(listener), policy);
+    }
+
+    /// <summary>
+    ///  Removes a listener added with <see cref="AddExtrinsicDataListener"/>.
+    /// </summary>
+    /// <param name="listener">Listener, which was added before.</param>
+    public static void RemoveExtrinsicDataListener(ExtrinsicDataAction listener)
+    {
+        extrinsicDataEvent.Remove(listener);
+    }
+
+    /// <summary>
+    ///  Adds a listener for tracking states with the given delivery policy.
+    /// </summary>
+    /// <remarks>
+    ///  See <see cref="AddImageListener"/>.
+    /// </remarks>
+    /// <param name="listener">
+    ///  Listener, which will receive the tracking states.
+    /// </param>
+    /// <param name="policy">Delivery policy of the listener.</param>
+    public static void AddTrackingStatesListener(TrackingStatesAction listener,
+        VLDeliveryPolicy policy)
+    {
+        trackingStatesEvent.Add(listener,
+            new Action<VLTrackingState>(listener), policy);
+    }
+
+    /// <summary>
+    ///  Removes a listener added with <see cref="AddTrackingStatesListener"/>.
+    /// </summary>
+    /// <param name="listener">Listener, which was added before.</param>
+    public static void RemoveTrackingStatesListener(TrackingStatesAction listener)
+    {
+        trackingStatesEvent.Remove(listener);
+    }
+
     /// <summary>
     ///  Target number of frames per second for the tracking thread.
     /// </summary>
@@ -262,6 +438,21 @@ public class VLWorkerBehaviour : MonoBehaviour
     [Tooltip("Update only if there is at least one tracking event.")]
     public bool waitForEvents = false;
 
+    /// <summary>
+    ///  Concurrency options of the worker.
+    /// </summary>
+    /// <remarks>
+    ///  <para>
+    ///   The options are applied when the worker gets created. Changes
+    ///   afterwards have no effect.
+    ///  </para>
+    ///  <para>
+    ///   Only the vlSDK stand-in supports the options. The VisionLib
+    ///   manages its threads internally.
+    ///  </para>
+    /// </remarks>
+    public VLWorkerOptions workerOptions = new VLWorkerOptions();
+
     private VLDeviceInfo deviceInfo = null;
 
     /// <summary>
@@ -285,11 +476,95 @@ public class VLWorkerBehaviour : MonoBehaviour
     public VLUnitySdk.LogLevel logLevel = VLUnitySdk.LogLevel.Warning;
     private VLUnitySdk.LogLevel lastLogLevel = VLUnitySdk.LogLevel.Warning;
 
+    /// <summary>
+    ///  Whether to record a trace of the worker.
+    /// </summary>
+    /// <remarks>
+    ///  If <c>true</c>, the execution of the worker functions, the event
+    ///  listeners and the Actions is recorded with <see cref="VLTrace"/>.
+    ///  The trace is written to "vlTrace.json" inside the persistent data
+    ///  path, when the behaviour gets destroyed. It can be viewed in
+    ///  Perfetto or chrome://tracing.
+    /// </remarks>
+    [Tooltip("Record a trace viewable in Perfetto or chrome://tracing.")]
+    public bool recordTrace = false;
+
     private VLAbstractApplicationWrapper aap = null;
     private VLLogger logger = null;
     private VLWorker worker = null;
     private GCHandle gcHandle;
     private string resourceDir;
+    private VLImageBufferPool imageBufferPool = new VLImageBufferPool();
+    private VLFrameClock frameClock = new VLFrameClock();
+    private VLFrameResult pendingFrameResult = null;
+    private float[] modelViewMatrix = new float[16];
+
+    private long framesProcessed = 0;
+    private long framesTracked = 0;
+    private long eventPolls = 0;
+    private long eventsReceived = 0;
+    private int eventsCurrentPoll = 0;
+    private int eventsLastPoll = 0;
+    private int eventsMaxPoll = 0;
+    private int numberOfTemplates = 0;
+
+    /// <summary>
+    ///  Releases the image buffers, which are currently not used.
+    /// </summary>
+    /// <returns>Number of bytes released.</returns>
+    public long TrimImageBuffers()
+    {
+        return this.imageBufferPool.Trim();
+    }
+
+    /// <summary>
+    ///  Returns a snapshot of the counters and gauges of the tracking
+    ///  runtime.
+    /// </summary>
+    /// <remarks>
+    ///  Should be called from the main thread.
+    /// </remarks>
+    public VLRuntimeCounters GetRuntimeCounters()
+    {
+        VLRuntimeCounters counters = new VLRuntimeCounters();
+        counters.timestamp = VLFrameClock.GetTime();
+        counters.framesReceived = this.frameClock.GetFrameIndex() + 1;
+        counters.framesProcessed = this.framesProcessed;
+        counters.framesTracked = this.framesTracked;
+        counters.imagesSkipped = imageEvent.GetReplacedCount();
+        counters.eventPolls = this.eventPolls;
+        counters.eventsReceived = this.eventsReceived;
+        counters.eventsLastPoll = this.eventsLastPoll;
+        counters.eventsMaxPoll = this.eventsMaxPoll;
+        counters.numberOfTemplates = this.numberOfTemplates;
+        counters.imageBufferAllocations =
+            this.imageBufferPool.GetAllocationCount();
+        counters.imageBytes = this.imageBufferPool.GetAcquiredBytes() +
+            this.imageBufferPool.GetFreeBufferBytes();
+        counters.garbageCollections = GC.CollectionCount(0);
+        counters.managedHeapBytes = GC.GetTotalMemory(false);
+        if (this.worker != null)
+        {
+            counters.commandsPushed = this.worker.GetPushedCommandCount();
+            counters.commandsProcessed =
+                this.worker.GetProcessedCommandCount();
+            counters.pendingCommands = this.worker.GetPendingCommandCount();
+        }
+        return counters;
+    }
+
+    /// <summary>
+    ///  Returns the clock, which assigns frame indices and timestamps to the
+    ///  events of the worker.
+    /// </summary>
+    /// <remarks>
+    ///  Listeners, which were added directly to the <see cref="VLWorker"/>,
+    ///  can use it for tagging their data with the current frame.
+    /// </remarks>
+    public VLFrameClock GetFrameClock()
+    {
+        return this.frameClock;
+    }
 
     /// <summary>
     ///  Returns the owned VLWorker object.
@@ -725,7 +1000,10 @@ public class VLWorkerBehaviour : MonoBehaviour
     {
         try
         {
-            GetInstance(clientData).ImageHandler(handle);
+            using (VLTrace.BeginSpan("ImageHandler"))
+            {
+                GetInstance(clientData).ImageHandler(handle);
+            }
         }
         catch (Exception e) // Catch all exceptions, because this is a callback
                             // invoked from native code
@@ -743,7 +1021,10 @@ public class VLWorkerBehaviour : MonoBehaviour
     {
         try
         {
-            GetInstance(clientData).ExtrinsicDataHandler(handle);
+            using (VLTrace.BeginSpan("ExtrinsicDataHandler"))
+            {
+                GetInstance(clientData).ExtrinsicDataHandler(handle);
+            }
         }
         catch (Exception e) // Catch all exceptions, because this is a callback
                             // invoked from native code
@@ -761,7 +1042,10 @@ public class VLWorkerBehaviour : MonoBehaviour
     {
         try
         {
-            GetInstance(clientData).IntrinsicDataHandler(handle);
+            using (VLTrace.BeginSpan("IntrinsicDataHandler"))
+            {
+                GetInstance(clientData).IntrinsicDataHandler(handle);
+            }
         }
         catch (Exception e) // Catch all exceptions, because this is a callback
                             // invoked from native code
@@ -779,7 +1063,10 @@ public class VLWorkerBehaviour : MonoBehaviour
     {
         try
         {
-            GetInstance(clientData).TrackingStateHandler(trackingStateJson);
+            using (VLTrace.BeginSpan("TrackingStateHandler"))
+            {
+                GetInstance(clientData).TrackingStateHandler(trackingStateJson);
+            }
         }
         catch (Exception e) // Catch all exceptions, because this is a callback
                             // called from native code
@@ -798,7 +1085,10 @@ public class VLWorkerBehaviour : MonoBehaviour
     {
         try
         {
-            GetInstance(clientData).PerformanceInfoHandler(performanceInfoJson);
+            using (VLTrace.BeginSpan("PerformanceInfoHandler"))
+            {
+                GetInstance(clientData).PerformanceInfoHandler(performanceInfoJson);
+            }
         }
         catch (Exception e) // Catch all exceptions, because this is a callback
                             // called from native code
@@ -900,25 +1190,132 @@ public class VLWorkerBehaviour : MonoBehaviour
         }
     }
 
-    private void ImageHandler(IntPtr handle)
+    /// <summary>
+    ///  Registers an event with the frame clock and finishes the previous
+    ///  frame, if the event starts a new one.
+    /// </summary>
+    /// <returns>
+    ///  Start ticks for measuring the dispatch time of the event.
+    /// </returns>
+    private long OnFrameEvent(VLFrameClock.EventKind kind)
+    {
+        ++this.eventsCurrentPoll;
+        if (this.frameClock.OnEvent(kind))
+        {
+            EmitFrameResult();
+
+            VLFrameTiming timing;
+            if (performanceStatistics.EndFrame(out timing) &&
+                OnFrameTiming != null)
+            {
+                OnFrameTiming(timing);
+            }
+            performanceStatistics.BeginFrame(this.frameClock.GetFrameIndex(),
+                this.frameClock.GetFrameArrivalTime());
+        }
+
+        return VLPerformanceStatistics.GetTicks();
+    }
+
+    private VLFrameResult GetPendingFrameResult()
+    {
+        if (OnFrameResult == null)
+        {
+            return null;
+        }
+
+        if (this.pendingFrameResult == null)
+        {
+            this.pendingFrameResult = new VLFrameResult(
+                this.frameClock.GetFrameIndex(),
+                this.frameClock.GetFrameTimestamp(),
+                this.frameClock.GetFrameArrivalTime());
+        }
+
+        return this.pendingFrameResult;
+    }
+
+    private void EmitFrameResult()
     {
-        if (OnImage != null)
+        VLFrameResult frameResult = this.pendingFrameResult;
+        if (frameResult == null)
+        {
+            return;
+        }
+        this.pendingFrameResult = null;
+
+        long startTicks = VLPerformanceStatistics.GetTicks();
+        try
         {
-            VLImageWrapper image = new VLImageWrapper(handle, false);
-            OnImage(image);
-            image.Dispose();
+            if (OnFrameResult != null)
+            {
+                OnFrameResult(frameResult);
+            }
+        }
+        finally
+        {
+            frameResult.Dispose();
+            performanceStatistics.AddDispatchTime(
+                VLFrameTiming.Stage.FrameResultDispatch, startTicks);
+        }
+    }
+
+    private void ImageHandler(IntPtr handle)
+    {
+        long startTicks = OnFrameEvent(VLFrameClock.EventKind.Image);
+
+        VLFrameResult frameResult = GetPendingFrameResult();
+        if (OnImage != null || frameResult != null || imageEvent.HasListeners())
+        {
+            // All listeners share the same copy of the image data. Listeners
+            // can keep the image beyond the callback by calling Retain.
+            VLImageWrapper image = new VLImageWrapper(
+                handle, false, this.imageBufferPool);
+            image.SetFrame(this.frameClock.GetFrameIndex(),
+                this.frameClock.GetFrameTimestamp());
+            if (frameResult != null)
+            {
+                frameResult.image = image.Retain();
+            }
+            if (OnImage != null)
+            {
+                OnImage(image);
+            }
+            imageEvent.Dispatch(image);
+            image.Release();
         }
+
+        performanceStatistics.AddDispatchTime(
+            VLFrameTiming.Stage.ImageDispatch, startTicks);
     }
 
     private void ExtrinsicDataHandler(IntPtr handle)
     {
+        long startTicks = OnFrameEvent(VLFrameClock.EventKind.ExtrinsicData);
+
         VLExtrinsicDataWrapper extrinsicData =
             new VLExtrinsicDataWrapper(handle, false);
+        extrinsicData.SetFrame(this.frameClock.GetFrameIndex(),
+            this.frameClock.GetFrameTimestamp());
+
+        VLFrameResult frameResult = GetPendingFrameResult();
+        if (frameResult != null)
+        {
+            frameResult.extrinsicData = extrinsicData.CreateSnapshot();
+        }
+
+        if (extrinsicData.GetModelViewMatrix(this.modelViewMatrix))
+        {
+            latestPose.Publish(this.modelViewMatrix, extrinsicData.GetValid(),
+                extrinsicData.GetFrameIndex(),
+                extrinsicData.GetFrameTimestamp());
+        }
 
         if (OnExtrinsicData != null)
         {
             OnExtrinsicData(extrinsicData);
         }
+        extrinsicDataEvent.Dispatch(extrinsicData);
 
         if (OnTrackingState != null)
         {
@@ -933,37 +1330,126 @@ public class VLWorkerBehaviour : MonoBehaviour
         }
 
         extrinsicData.Dispose();
+
+        performanceStatistics.AddDispatchTime(
+            VLFrameTiming.Stage.ExtrinsicDataDispatch, startTicks);
     }
 
     private void IntrinsicDataHandler(IntPtr handle)
     {
-        if (OnIntrinsicData != null)
+        long startTicks = OnFrameEvent(VLFrameClock.EventKind.IntrinsicData);
+
+        VLFrameResult frameResult = GetPendingFrameResult();
+        if (OnIntrinsicData != null || frameResult != null)
         {
             VLIntrinsicDataWrapper intrinsicData =
                 new VLIntrinsicDataWrapper(handle, false);
-            OnIntrinsicData(intrinsicData);
+            intrinsicData.SetFrame(this.frameClock.GetFrameIndex(),
+                this.frameClock.GetFrameTimestamp());
+            if (frameResult != null)
+            {
+                frameResult.intrinsicData = intrinsicData.CreateSnapshot();
+            }
+            if (OnIntrinsicData != null)
+            {
+                OnIntrinsicData(intrinsicData);
+            }
             intrinsicData.Dispose();
         }
+
+        performanceStatistics.AddDispatchTime(
+            VLFrameTiming.Stage.IntrinsicDataDispatch, startTicks);
     }
 
     private void TrackingStateHandler(string trackingStateJson)
     {
+        long startTicks = OnFrameEvent(VLFrameClock.EventKind.TrackingStates);
+
         VLTrackingState state =
             VLJsonUtility.FromJson<VLTrackingState>(trackingStateJson);
-        if (state != null && OnTrackingStates != null)
+        if (state == null)
+        {
+            return;
+        }
+        // All objects of a frame share the capture time of its image
+        if (state.objects != null && state.objects.Length > 0 &&
+            this.frameClock.SetCaptureTime(state.objects[0].timeStamp))
+        {
+            latestPose.SetFrameTimestamp(this.frameClock.GetFrameIndex(),
+                this.frameClock.GetFrameTimestamp());
+            if (this.pendingFrameResult != null)
+            {
+                this.pendingFrameResult.SetFrameTimestamp(
+                    this.frameClock.GetFrameTimestamp());
+            }
+        }
+        state.frameIndex = this.frameClock.GetFrameIndex();
+        state.frameTimestamp = this.frameClock.GetFrameTimestamp();
+        state.frameArrivalTime = this.frameClock.GetFrameArrivalTime();
+
+        ++this.framesProcessed;
+        if (state.objects != null)
+        {
+            // A frame counts as tracked, if any object was tracked
+            bool tracked = false;
+            int templates = 0;
+            for (int i = 0; i < state.objects.Length; ++i)
+            {
+                VLTrackingStateInfo.State trackingState =
+                    VLTrackingStateInfo.ParseState(state.objects[i].state);
+                tracked = tracked ||
+                    trackingState == VLTrackingStateInfo.State.Tracked ||
+                    trackingState == VLTrackingStateInfo.State.Critical;
+                templates += state.objects[i]._NumberOfTemplates;
+            }
+            if (tracked)
+            {
+                ++this.framesTracked;
+            }
+            this.numberOfTemplates = templates;
+        }
+
+        VLFrameResult frameResult = GetPendingFrameResult();
+        if (frameResult != null)
+        {
+            frameResult.trackingState = state;
+        }
+
+        if (OnTrackingStates != null)
         {
             OnTrackingStates(state);
         }
+        trackingStatesEvent.Dispatch(state);
+
+        if (OnTrackingStateInfo != null && state.objects != null)
+        {
+            for (int i = 0; i < state.objects.Length; ++i)
+            {
+                OnTrackingStateInfo(VLTrackingStateInfo.FromTrackingObject(
+                    state.objects[i], state.frameIndex,
+                    state.frameTimestamp));
+            }
+        }
+
+        performanceStatistics.AddDispatchTime(
+            VLFrameTiming.Stage.TrackingStatesDispatch, startTicks);
     }
 
     private void PerformanceInfoHandler(string performanceInfoJson)
     {
+        long startTicks =
+            OnFrameEvent(VLFrameClock.EventKind.PerformanceInfo);
+
         VLPerformanceInfo performanceInfo =
             VLJsonUtility.FromJson<VLPerformanceInfo>(performanceInfoJson);
+        performanceStatistics.SetPerformanceInfo(performanceInfo);
         if (OnPerformanceInfo != null)
         {
             OnPerformanceInfo(performanceInfo);
         }
+
+        performanceStatistics.AddDispatchTime(
+            VLFrameTiming.Stage.PerformanceInfoDispatch, startTicks);
     }
 
     private void Awake()
@@ -977,6 +1463,11 @@ public class VLWorkerBehaviour : MonoBehaviour
         // stored in a global handle table.
         this.gcHandle = GCHandle.Alloc(this);
 
+        if (this.recordTrace)
+        {
+            VLTrace.Start();
+        }
+
         // Print the version of the vlUnitySDK. If this works, then we can be
         // quite certain, that other things also work.
 
@@ -1074,9 +1565,15 @@ public class VLWorkerBehaviour : MonoBehaviour
 #endif
         this.aap.AutoLoadPlugins(pluginPath);
 
+        // Select the faster image conversion kernels for this device once
+        if (!VLImageConversion.IsCalibrated())
+        {
+            VLImageConversion.Calibrate();
+        }
+
         // Create worker instance and register listeners for it
 
-        this.worker = new VLWorker(this.aap);
+        this.worker = new VLWorker(this.aap, this.workerOptions);
 
         if (!this.worker.AddImageListener(
             dispatchImageCallbackDelegate,
@@ -1148,6 +1645,12 @@ public class VLWorkerBehaviour : MonoBehaviour
             Debug.LogWarning("[vlUnitySDK] Failed to remove image listener");
         }
 
+        // Drop events, which haven't been delivered yet
+        imageEvent.Clear();
+        extrinsicDataEvent.Clear();
+        trackingStatesEvent.Clear();
+        performanceStatistics.Reset();
+
         // Release the worker reference (this is necessary, because it
         // references native resources)
         this.worker.Dispose();
@@ -1165,6 +1668,17 @@ public class VLWorkerBehaviour : MonoBehaviour
 
         // Release the handle to the current object
         this.gcHandle.Free();
+
+        if (this.recordTrace && VLTrace.IsEnabled())
+        {
+            VLTrace.Stop();
+            string tracePath = Path.Combine(
+                Application.persistentDataPath, "vlTrace.json");
+            if (VLTrace.WriteChromeTrace(tracePath))
+            {
+                Debug.Log("[vlUnitySDK] Wrote trace to '" + tracePath + "'");
+            }
+        }
     }
 
     private void OnApplicationQuit()
@@ -1172,6 +1686,14 @@ public class VLWorkerBehaviour : MonoBehaviour
     }
 
     private void Update()
+    {
+        using (VLTrace.BeginSpan("VLWorkerBehaviour.Update"))
+        {
+            UpdateWorker();
+        }
+    }
+
+    private void UpdateWorker()
     {
         // if (!this.aap.ActivateFoundBlockedFeatures())
         // {
@@ -1205,8 +1727,25 @@ public class VLWorkerBehaviour : MonoBehaviour
             this.worker.PollEvents();
         }
 
+        ++this.eventPolls;
+        this.eventsReceived += this.eventsCurrentPoll;
+        this.eventsLastPoll = this.eventsCurrentPoll;
+        this.eventsMaxPoll =
+            Math.Max(this.eventsMaxPoll, this.eventsCurrentPoll);
+        this.eventsCurrentPoll = 0;
+
+        // Deliver the newest events to the LatestOnly listeners
+        imageEvent.Flush();
+        extrinsicDataEvent.Flush();
+        trackingStatesEvent.Flush();
+
+        // All events of the last frame have been received now
+        EmitFrameResult();
+
 #if UNITY_2017_1_OR_NEWER
         this.logger.FlushLogBuffer();
+#else
+        VLLogBuffer.Flush();
 #endif
     }
 
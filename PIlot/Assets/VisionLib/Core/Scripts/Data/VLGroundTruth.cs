@@ -0,0 +1,69 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+
+/// <summary>
+///  VLGroundTruth stores the exact camera parameters of a synthetic image
+///  sequence.
+/// </summary>
+/// <remarks>
+///  The poses use the same convention as
+///  <see cref="VLExtrinsicDataWrapper.GetT"/> and
+///  <see cref="VLExtrinsicDataWrapper.GetR"/>.
+/// </remarks>
+[Serializable]
+public class VLGroundTruth
+{
+    /// <summary>
+    ///  Intrinsic camera parameters normalized by the image size.
+    /// </summary>
+    [Serializable]
+    public class Intrinsics
+    {
+        /// <summary>Width of the images in pixels.</summary>
+        public int width;
+        /// <summary>Height of the images in pixels.</summary>
+        public int height;
+        /// <summary>Horizontal focal length divided by the width.</summary>
+        public float fxNorm;
+        /// <summary>Vertical focal length divided by the height.</summary>
+        public float fyNorm;
+        /// <summary>
+        ///  Horizontal principal point divided by the width.
+        /// </summary>
+        public float cxNorm;
+        /// <summary>
+        ///  Vertical principal point divided by the height.
+        /// </summary>
+        public float cyNorm;
+    }
+
+    /// <summary>
+    ///  Pose of the camera relative to the model for one image.
+    /// </summary>
+    [Serializable]
+    public class Pose
+    {
+        /// <summary>Name of the image file.</summary>
+        public string image;
+        /// <summary>Translation (x, y, z).</summary>
+        public float[] t;
+        /// <summary>Rotation as quaternion (x, y, z, w).</summary>
+        public float[] q;
+    }
+
+    /// <summary>
+    ///  Intrinsic camera parameters of all images. The images are rendered
+    ///  without lens distortion.
+    /// </summary>
+    public Intrinsics intrinsics;
+
+    /// <summary>
+    ///  Poses of the camera in the order of the images.
+    /// </summary>
+    public Pose[] poses;
+}
+
+/**@}*/
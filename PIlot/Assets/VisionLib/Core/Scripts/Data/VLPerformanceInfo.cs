@@ -15,5 +15,35 @@ public struct VLPerformanceInfo
     /// duration for achieving the target FPS.
     /// </summary>
     public int processingTime;
+
+    /// <summary>
+    ///  Time in milliseconds for acquiring and preprocessing the camera
+    ///  image.
+    /// </summary>
+    /// <remarks>
+    ///  Only the vlSDK stand-in reports the stages. The value is zero
+    ///  otherwise.
+    /// </remarks>
+    public float acquisitionTime;
+
+    /// <summary>
+    ///  Time in milliseconds for estimating the pose.
+    /// </summary>
+    /// <remarks>
+    ///  Only the vlSDK stand-in reports the stages. The value is zero
+    ///  otherwise.
+    /// </remarks>
+    public float trackingTime;
+
+    /// <summary>
+    ///  Time in milliseconds from the start of the acquisition until the
+    ///  pose was estimated. In the pipelined mode this includes the time
+    ///  the frame waited for the tracking.
+    /// </summary>
+    /// <remarks>
+    ///  Only the vlSDK stand-in reports the stages. The value is zero
+    ///  otherwise.
+    /// </remarks>
+    public float pipelineLatency;
 }
 /**@}*/
\ No newline at end of file
@@ -0,0 +1,97 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+using UnityEngine;
+
+/// <summary>
+///  VLWorkerOptions stores the concurrency settings of a worker.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The options are passed to <c>vlNew_WorkerWithOptions</c>, which
+///   distributes the data-parallel stages of each frame over a
+///   work-stealing pool. Only the vlSDK stand-in in
+///   PIlot/Tools/vlSDKStandIn provides this function. The VisionLib
+///   manages its threads internally and ignores the options.
+///  </para>
+///  <para>
+///   The default values create a worker like <c>vlNew_Worker</c>.
+///  </para>
+/// </remarks>
+[Serializable]
+public class VLWorkerOptions
+{
+    /// <summary>
+    ///  Scheduling priority of the threads.
+    /// </summary>
+    public enum Priority
+    {
+        Low = -1,
+        Normal = 0,
+        High = 1
+    }
+
+    /// <summary>
+    ///  Number of threads including the tracking thread. Zero uses all
+    ///  cores of the affinity mask.
+    /// </summary>
+    [Tooltip("Number of tracking threads. 0 uses all cores of the affinity mask.")]
+    public int threadCount = 1;
+
+    /// <summary>
+    ///  CPUs the threads may run on, e.g. "0xf0" for the cores 4 to 7.
+    ///  Empty doesn't restrict the threads.
+    /// </summary>
+    /// <remarks>
+    ///  The mask is a string, because JSON numbers can't represent all 64
+    ///  bit masks.
+    /// </remarks>
+    [Tooltip("CPUs the tracking threads may run on, e.g. 0xf0. Empty uses all CPUs.")]
+    public string affinityMask = "";
+
+    /// <summary>
+    ///  Priority of the threads.
+    /// </summary>
+    /// <remarks>
+    ///  Raising the priority requires the permission to do so and is
+    ///  ignored otherwise.
+    /// </remarks>
+    [Tooltip("Scheduling priority of the tracking threads.")]
+    public Priority priority = Priority.Normal;
+
+    /// <summary>
+    ///  Whether the next frames are acquired and preprocessed on a separate
+    ///  thread, while the current frame is tracked.
+    /// </summary>
+    /// <remarks>
+    ///  The throughput approaches the slowest stage instead of the sum of
+    ///  all stages, but each frame waits up to <see cref="pipelineDepth"/>
+    ///  frames for the tracking. Only the asynchronous worker supports the
+    ///  pipelined mode.
+    /// </remarks>
+    [Tooltip("Acquire the next frames while the current frame is tracked.")]
+    public bool pipelined = false;
+
+    /// <summary>
+    ///  Maximum number of acquired frames waiting for the tracking in the
+    ///  pipelined mode.
+    /// </summary>
+    [Tooltip("Maximum number of acquired frames waiting for the tracking.")]
+    public int pipelineDepth = 2;
+
+    /// <summary>
+    ///  Returns <c>true</c>, if the options don't differ from the behaviour
+    ///  of <c>vlNew_Worker</c>.
+    /// </summary>
+    public bool IsDefault()
+    {
+        return this.threadCount == 1 &&
+            String.IsNullOrEmpty(this.affinityMask) &&
+            this.priority == Priority.Normal &&
+            !this.pipelined;
+    }
+}
+
+/**@}*/
@@ -112,7 +112,7 @@ public class VLDebugImageBehaviour : VLWorkerReferenceBehaviour
     private GCHandle gcHandle;
 
     private Texture2D texture;
-    private byte[] textureData;
+    private VLImageBufferPool imageBufferPool = new VLImageBufferPool();
 
     private RectTransform imageRectTransform;
     private VLAspectRatioFitter imageAspectRatioFitter;
@@ -203,12 +203,13 @@ public class VLDebugImageBehaviour : VLWorkerReferenceBehaviour
     {
         try
         {
-            VLImageWrapper image = new VLImageWrapper(handle, false);
             GCHandle gcHandle = GCHandle.FromIntPtr(clientData);
             VLDebugImageBehaviour debugImageBehaviour =
                 (VLDebugImageBehaviour)gcHandle.Target;
+            VLImageWrapper image = new VLImageWrapper(
+                handle, false, debugImageBehaviour.imageBufferPool);
             debugImageBehaviour.OnImage(image);
-            image.Dispose();
+            image.Release();
         }
         catch (Exception e) // Catch all exceptions, because this is a callback
                             // invoked from native code
@@ -293,16 +294,10 @@ public class VLDebugImageBehaviour : VLWorkerReferenceBehaviour
         int imageHeight = image.GetHeight();
         if (imageWidth > 0 && imageHeight > 0)
         {
-            int imageByteSize = imageWidth * imageHeight *
-                image.GetBytesPerPixel();
-            if (this.textureData == null ||
-                this.textureData.Length != imageByteSize)
-            {
-                this.textureData = new byte[imageByteSize];
-            }
-
-            // Copy the image into a byte array
-            if (image.CopyToBuffer(this.textureData))
+            // Access the image data without copying it into an own byte array
+            byte[] imageData;
+            int imageStride;
+            if (image.Lock(out imageData, out imageStride))
             {
                 // Generate a texture from the byte array
                 VLUnitySdk.ImageFormat imageFormat = image.GetFormat();
@@ -322,9 +317,11 @@ public class VLDebugImageBehaviour : VLWorkerReferenceBehaviour
 
                 if (this.texture)
                 {
-                    this.texture.LoadRawTextureData(this.textureData);
+                    this.texture.LoadRawTextureData(imageData);
                     this.texture.Apply();
                 }
+
+                image.Unlock();
             }
         }
     }
@@ -332,7 +329,6 @@ public class VLDebugImageBehaviour : VLWorkerReferenceBehaviour
     private void Awake()
     {
         this.texture = Texture2D.blackTexture;
-        this.textureData = new byte[1];
 
         if (this.imageObject != null)
         {
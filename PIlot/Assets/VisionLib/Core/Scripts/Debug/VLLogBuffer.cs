@@ -0,0 +1,531 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Threading;
+using UnityEngine;
+
+/// <summary>
+///  Buffers log messages of the vlUnitySDK and formats them lazily on the
+///  main thread.
+/// </summary>
+/// <remarks>
+///  <para>
+///   Each thread writes its log records into its own ring buffer, which is
+///   read by <see cref="Flush"/>. Writing a record doesn't take any locks
+///   and doesn't format the message. The format string and the arguments
+///   are stored as they are and only formatted during the flush.
+///  </para>
+///  <para>
+///   The log level is checked before anything else. Messages with a level
+///   above the current log level therefore only cost a comparison.
+///   Arguments are passed generically and stored in typed slots.
+///   <c>int</c>, <c>long</c>, <c>uint</c>, <c>ulong</c>, <c>float</c>,
+///   <c>double</c>, <c>bool</c> and <c>char</c> arguments are therefore
+///   only boxed during the flush. Other value types are boxed when they are
+///   logged.
+///  </para>
+///  <para>
+///   If a ring buffer is full, further messages of the thread are dropped
+///   until the next flush. The number of dropped messages is reported
+///   during the flush. The ring of a thread is released by the first flush
+///   after the thread has ended.
+///  </para>
+/// </remarks>
+public static class VLLogBuffer
+{
+    private enum ArgType
+    {
+        None = 0,
+        Int32,
+        Int64,
+        UInt32,
+        UInt64,
+        Single,
+        Double,
+        Boolean,
+        Char,
+        Reference
+    }
+
+    // Numbers share one 64 bit slot. Strings and other objects are stored
+    // as reference.
+    [StructLayout(LayoutKind.Explicit)]
+    private struct Value
+    {
+        [FieldOffset(0)]
+        public long integer;
+        [FieldOffset(0)]
+        public ulong unsignedInteger;
+        [FieldOffset(0)]
+        public double real;
+    }
+
+    private struct Arg
+    {
+        public ArgType type;
+        public Value value;
+        public object reference;
+    }
+
+    private delegate void ArgSetter<T>(ref Arg arg, T value);
+
+    // Selects a setter without boxing once per argument type
+    private static class ArgSetters<T>
+    {
+        public static readonly ArgSetter<T> set = CreateSetter<T>();
+    }
+
+    private struct Record
+    {
+        public VLUnitySdk.LogLevel level;
+        public string format;
+        public int argCount;
+        public Arg arg0;
+        public Arg arg1;
+        public Arg arg2;
+    }
+
+    private class Ring
+    {
+        public readonly Record[] records;
+        public readonly int mask;
+        public readonly Thread owner;
+        public int head = 0;
+        public int tail = 0;
+        public int dropped = 0;
+        public int reportedDropped = 0;
+
+        public Ring(int capacity)
+        {
+            this.records = new Record[capacity];
+            this.mask = capacity - 1;
+            this.owner = Thread.CurrentThread;
+        }
+    }
+
+    [ThreadStatic]
+    private static Ring threadRing;
+
+    private static readonly object lockObject = new object();
+    private static readonly List<Ring> rings = new List<Ring>();
+    private static readonly Record emptyRecord = new Record();
+    private static readonly object[] formatArgs1 = new object[1];
+    private static readonly object[] formatArgs2 = new object[2];
+    private static readonly object[] formatArgs3 = new object[3];
+    private static int ringCapacity = 1024;
+    private static volatile int logLevel = (int)VLUnitySdk.LogLevel.Warning;
+
+    /// <summary>
+    ///  Sets the log level. Messages with a higher level are discarded.
+    /// </summary>
+    /// <remarks>
+    ///  <see cref="VLLogger.SetLogLevel"/> sets the log level of the
+    ///  VisionLib and of the VLLogBuffer.
+    /// </remarks>
+    public static void SetLogLevel(VLUnitySdk.LogLevel level)
+    {
+        logLevel = (int)level;
+    }
+
+    /// <summary>
+    ///  Returns the current log level.
+    /// </summary>
+    public static VLUnitySdk.LogLevel GetLogLevel()
+    {
+        return (VLUnitySdk.LogLevel)logLevel;
+    }
+
+    /// <summary>
+    ///  Returns whether messages with the given level are logged.
+    /// </summary>
+    /// <remarks>
+    ///  This can be used to skip the computation of expensive arguments.
+    /// </remarks>
+    public static bool IsEnabled(VLUnitySdk.LogLevel level)
+    {
+        return (int)level <= logLevel;
+    }
+
+    /// <summary>
+    ///  Sets the number of records buffered per thread.
+    /// </summary>
+    /// <remarks>
+    ///  Only affects threads, which didn't log anything yet.
+    /// </remarks>
+    /// <param name="capacity">
+    ///  Number of records. Will be rounded up to a power of two.
+    /// </param>
+    public static void SetRingCapacity(int capacity)
+    {
+        if (capacity < 1)
+        {
+            throw new ArgumentOutOfRangeException("capacity");
+        }
+
+        int powerOfTwo = 1;
+        while (powerOfTwo < capacity)
+        {
+            powerOfTwo <<= 1;
+        }
+        lock (lockObject)
+        {
+            ringCapacity = powerOfTwo;
+        }
+    }
+
+    /// <summary>
+    ///  Logs a message without arguments.
+    /// </summary>
+    public static void Log(VLUnitySdk.LogLevel level, string message)
+    {
+        if ((int)level > logLevel)
+        {
+            return;
+        }
+        Ring ring;
+        int index;
+        if (BeginAppend(out ring, out index))
+        {
+            SetRecord(ring, index, level, message, 0);
+            EndAppend(ring);
+        }
+    }
+
+    /// <summary>
+    ///  Logs a message with one argument.
+    /// </summary>
+    /// <param name="level">Level of the message.</param>
+    /// <param name="format">
+    ///  Format string as used by <c>string.Format</c>. Should be a constant
+    ///  string.
+    /// </param>
+    /// <param name="arg0">First argument.</param>
+    public static void Log<T0>(VLUnitySdk.LogLevel level, string format,
+        T0 arg0)
+    {
+        if ((int)level > logLevel)
+        {
+            return;
+        }
+        Ring ring;
+        int index;
+        if (BeginAppend(out ring, out index))
+        {
+            SetRecord(ring, index, level, format, 1);
+            ArgSetters<T0>.set(ref ring.records[index].arg0, arg0);
+            EndAppend(ring);
+        }
+    }
+
+    /// <summary>
+    ///  Logs a message with two arguments.
+    /// </summary>
+    public static void Log<T0, T1>(VLUnitySdk.LogLevel level, string format,
+        T0 arg0, T1 arg1)
+    {
+        if ((int)level > logLevel)
+        {
+            return;
+        }
+        Ring ring;
+        int index;
+        if (BeginAppend(out ring, out index))
+        {
+            SetRecord(ring, index, level, format, 2);
+            ArgSetters<T0>.set(ref ring.records[index].arg0, arg0);
+            ArgSetters<T1>.set(ref ring.records[index].arg1, arg1);
+            EndAppend(ring);
+        }
+    }
+
+    /// <summary>
+    ///  Logs a message with three arguments.
+    /// </summary>
+    public static void Log<T0, T1, T2>(VLUnitySdk.LogLevel level,
+        string format, T0 arg0, T1 arg1, T2 arg2)
+    {
+        if ((int)level > logLevel)
+        {
+            return;
+        }
+        Ring ring;
+        int index;
+        if (BeginAppend(out ring, out index))
+        {
+            SetRecord(ring, index, level, format, 3);
+            ArgSetters<T0>.set(ref ring.records[index].arg0, arg0);
+            ArgSetters<T1>.set(ref ring.records[index].arg1, arg1);
+            ArgSetters<T2>.set(ref ring.records[index].arg2, arg2);
+            EndAppend(ring);
+        }
+    }
+
+    private static bool BeginAppend(out Ring ring, out int index)
+    {
+        ring = GetThreadRing();
+        int tail = ring.tail;
+        if (tail - Volatile.Read(ref ring.head) >= ring.records.Length)
+        {
+            ++ring.dropped;
+            index = -1;
+            return false;
+        }
+
+        index = tail & ring.mask;
+        return true;
+    }
+
+    private static void SetRecord(Ring ring, int index,
+        VLUnitySdk.LogLevel level, string format, int argCount)
+    {
+        ring.records[index].level = level;
+        ring.records[index].format = format;
+        ring.records[index].argCount = argCount;
+    }
+
+    private static void EndAppend(Ring ring)
+    {
+        // Publish the record after it was written completely
+        Volatile.Write(ref ring.tail, ring.tail + 1);
+    }
+
+    private static ArgSetter<T> CreateSetter<T>()
+    {
+        Type type = typeof(T);
+        Delegate setter;
+        if (type == typeof(int))
+        {
+            setter = new ArgSetter<int>(SetInt32);
+        }
+        else if (type == typeof(long))
+        {
+            setter = new ArgSetter<long>(SetInt64);
+        }
+        else if (type == typeof(uint))
+        {
+            setter = new ArgSetter<uint>(SetUInt32);
+        }
+        else if (type == typeof(ulong))
+        {
+            setter = new ArgSetter<ulong>(SetUInt64);
+        }
+        else if (type == typeof(float))
+        {
+            setter = new ArgSetter<float>(SetSingle);
+        }
+        else if (type == typeof(double))
+        {
+            setter = new ArgSetter<double>(SetDouble);
+        }
+        else if (type == typeof(bool))
+        {
+            setter = new ArgSetter<bool>(SetBoolean);
+        }
+        else if (type == typeof(char))
+        {
+            setter = new ArgSetter<char>(SetChar);
+        }
+        else
+        {
+            setter = new ArgSetter<T>(SetReference);
+        }
+        return (ArgSetter<T>)setter;
+    }
+
+    private static void SetInt32(ref Arg arg, int value)
+    {
+        arg.type = ArgType.Int32;
+        arg.value.integer = value;
+    }
+
+    private static void SetInt64(ref Arg arg, long value)
+    {
+        arg.type = ArgType.Int64;
+        arg.value.integer = value;
+    }
+
+    private static void SetUInt32(ref Arg arg, uint value)
+    {
+        arg.type = ArgType.UInt32;
+        arg.value.unsignedInteger = value;
+    }
+
+    private static void SetUInt64(ref Arg arg, ulong value)
+    {
+        arg.type = ArgType.UInt64;
+        arg.value.unsignedInteger = value;
+    }
+
+    private static void SetSingle(ref Arg arg, float value)
+    {
+        arg.type = ArgType.Single;
+        arg.value.real = value;
+    }
+
+    private static void SetDouble(ref Arg arg, double value)
+    {
+        arg.type = ArgType.Double;
+        arg.value.real = value;
+    }
+
+    private static void SetBoolean(ref Arg arg, bool value)
+    {
+        arg.type = ArgType.Boolean;
+        arg.value.integer = value ? 1 : 0;
+    }
+
+    private static void SetChar(ref Arg arg, char value)
+    {
+        arg.type = ArgType.Char;
+        arg.value.integer = value;
+    }
+
+    private static void SetReference<T>(ref Arg arg, T value)
+    {
+        arg.type = ArgType.Reference;
+        arg.reference = value;
+    }
+
+    private static object GetObject(ref Arg arg)
+    {
+        switch (arg.type)
+        {
+            case ArgType.Int32:
+                return (int)arg.value.integer;
+            case ArgType.Int64:
+                return arg.value.integer;
+            case ArgType.UInt32:
+                return (uint)arg.value.unsignedInteger;
+            case ArgType.UInt64:
+                return arg.value.unsignedInteger;
+            case ArgType.Single:
+                return (float)arg.value.real;
+            case ArgType.Double:
+                return arg.value.real;
+            case ArgType.Boolean:
+                return arg.value.integer != 0;
+            case ArgType.Char:
+                return (char)arg.value.integer;
+            default:
+                return arg.reference;
+        }
+    }
+
+    private static Ring GetThreadRing()
+    {
+        Ring ring = threadRing;
+        if (ring == null)
+        {
+            lock (lockObject)
+            {
+                ring = new Ring(ringCapacity);
+                rings.Add(ring);
+            }
+            threadRing = ring;
+        }
+        return ring;
+    }
+
+    /// <summary>
+    ///  Formats all buffered messages and writes them to the Unity console.
+    /// </summary>
+    /// <remarks>
+    ///  Must only be called from one thread at a time. The VLWorkerBehaviour
+    ///  calls it from the main thread once per frame.
+    /// </remarks>
+    public static void Flush()
+    {
+        lock (lockObject)
+        {
+            for (int i = rings.Count - 1; i >= 0; --i)
+            {
+                Ring ring = rings[i];
+                // Check before flushing, so the last records of an ended
+                // thread can't be missed
+                bool ended = !ring.owner.IsAlive;
+                FlushRing(ring);
+                if (ended)
+                {
+                    rings.RemoveAt(i);
+                }
+            }
+        }
+    }
+
+    private static void FlushRing(Ring ring)
+    {
+        int head = ring.head;
+        int tail = Volatile.Read(ref ring.tail);
+        for (; head != tail; ++head)
+        {
+            int index = head & ring.mask;
+            Record record = ring.records[index];
+            ring.records[index] = emptyRecord;
+
+            // Publish the free slot before formatting, so the writer can
+            // continue logging
+            Volatile.Write(ref ring.head, head + 1);
+
+            Write(record.level, "[vlUnitySDK] " + Format(record));
+        }
+
+        int dropped = Volatile.Read(ref ring.dropped);
+        if (dropped != ring.reportedDropped)
+        {
+            Write(VLUnitySdk.LogLevel.Warning, "[vlUnitySDK] Dropped " +
+                (dropped - ring.reportedDropped) +
+                " log messages, because the log buffer was full");
+            ring.reportedDropped = dropped;
+        }
+    }
+
+    private static string Format(Record record)
+    {
+        try
+        {
+            switch (record.argCount)
+            {
+                case 1:
+                    formatArgs1[0] = GetObject(ref record.arg0);
+                    return string.Format(record.format, formatArgs1);
+                case 2:
+                    formatArgs2[0] = GetObject(ref record.arg0);
+                    formatArgs2[1] = GetObject(ref record.arg1);
+                    return string.Format(record.format, formatArgs2);
+                case 3:
+                    formatArgs3[0] = GetObject(ref record.arg0);
+                    formatArgs3[1] = GetObject(ref record.arg1);
+                    formatArgs3[2] = GetObject(ref record.arg2);
+                    return string.Format(record.format, formatArgs3);
+                default:
+                    return record.format;
+            }
+        }
+        catch (FormatException)
+        {
+            return record.format;
+        }
+    }
+
+    private static void Write(VLUnitySdk.LogLevel level, string message)
+    {
+        switch (level)
+        {
+            case VLUnitySdk.LogLevel.Fatal:
+                Debug.LogError(message);
+                break;
+            case VLUnitySdk.LogLevel.Warning:
+                Debug.LogWarning(message);
+                break;
+            default:
+                Debug.Log(message);
+                break;
+        }
+    }
+}
+
+/**@}*/
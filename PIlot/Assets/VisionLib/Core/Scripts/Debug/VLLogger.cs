@@ -118,8 +118,13 @@ public class VLLogger: IDisposable
         VLUnitySdk.DisableLogBuffer();
     }
 
+    /// <summary>
+    ///  Writes the buffered log messages of the VisionLib and of the
+    ///  <see cref="VLLogBuffer"/> to the Unity console.
+    /// </summary>
     public bool FlushLogBuffer()
     {
+        VLLogBuffer.Flush();
         return VLUnitySdk.FlushLogBuffer();
     }
 
@@ -128,8 +133,13 @@ public class VLLogger: IDisposable
         return VLUnitySdk.GetLogLevel();
     }
 
+    /// <summary>
+    ///  Sets the log level of the VisionLib and of the
+    ///  <see cref="VLLogBuffer"/>.
+    /// </summary>
     public bool SetLogLevel(VLUnitySdk.LogLevel level)
     {
+        VLLogBuffer.SetLogLevel(level);
         return VLUnitySdk.SetLogLevel(level);
     }
 
@@ -0,0 +1,112 @@
+using UnityEngine;
+using UnityEditor;
+using System;
+using System.Diagnostics;
+using System.Text;
+
+/// <summary>
+///  Measures the throughput of the <see cref="VLImageConversion"/> kernels
+///  at common camera resolutions.
+/// </summary>
+/// <remarks>
+///  The benchmark can be started from the menu or in batch mode using
+///  <c>-batchmode -quit -executeMethod VLImageConversionBenchmark.Run</c>.
+///  The throughput is reported in GB/s of source image data.
+/// </remarks>
+public static class VLImageConversionBenchmark
+{
+    private static readonly int[,] resolutions = new int[,]
+    {
+        { 640, 480 },
+        { 1280, 720 },
+        { 1920, 1080 }
+    };
+
+    private const int warmupIterations = 3;
+    private const double minSeconds = 0.25;
+
+    [MenuItem("VisionLib/Benchmarks/Image Conversion")]
+    public static void Run()
+    {
+        // Calibrating changes the global selection, which is restored
+        // afterwards
+        Array conversions =
+            Enum.GetValues(typeof(VLImageConversion.Conversion));
+        VLImageConversion.Implementation[] previousImplementations =
+            new VLImageConversion.Implementation[conversions.Length];
+        for (int i = 0; i < conversions.Length; ++i)
+        {
+            previousImplementations[i] = VLImageConversion.GetImplementation(
+                (VLImageConversion.Conversion)conversions.GetValue(i));
+        }
+        VLImageConversion.Calibrate();
+
+        StringBuilder report = new StringBuilder();
+        report.AppendLine("[vlUnitySDK] Image conversion throughput (GB/s)");
+        report.AppendLine("conversion  resolution  scalar  packed  selected");
+
+        foreach (VLImageConversion.Conversion conversion in conversions)
+        {
+            int srcBytesPerPixel;
+            int dstBytesPerPixel;
+            VLImageConversion.GetBytesPerPixel(
+                conversion, out srcBytesPerPixel, out dstBytesPerPixel);
+
+            for (int r = 0; r < resolutions.GetLength(0); ++r)
+            {
+                int width = resolutions[r, 0];
+                int height = resolutions[r, 1];
+                int pixelCount = width * height;
+                byte[] src = new byte[pixelCount * srcBytesPerPixel];
+                byte[] dst = new byte[pixelCount * dstBytesPerPixel];
+                new System.Random(0).NextBytes(src);
+
+                double scalar = Measure(conversion,
+                    VLImageConversion.Implementation.Scalar, src, dst,
+                    pixelCount);
+                double packed = Measure(conversion,
+                    VLImageConversion.Implementation.Packed, src, dst,
+                    pixelCount);
+
+                report.AppendFormat("{0,-11} {1,4}x{2,-5}  {3,6:F2}  {4,6:F2}  {5}\n",
+                    conversion, width, height, scalar, packed,
+                    VLImageConversion.GetImplementation(conversion));
+            }
+        }
+
+        for (int i = 0; i < conversions.Length; ++i)
+        {
+            VLImageConversion.SetImplementation(
+                (VLImageConversion.Conversion)conversions.GetValue(i),
+                previousImplementations[i]);
+        }
+
+        UnityEngine.Debug.Log(report.ToString());
+    }
+
+    private static double Measure(VLImageConversion.Conversion conversion,
+        VLImageConversion.Implementation implementation, byte[] src,
+        byte[] dst, int pixelCount)
+    {
+        for (int i = 0; i < warmupIterations; ++i)
+        {
+            VLImageConversion.Convert(
+                conversion, implementation, src, dst, pixelCount);
+        }
+
+        // Repeat until the measurement is long enough to be stable
+        int iterations = 0;
+        Stopwatch stopwatch = Stopwatch.StartNew();
+        do
+        {
+            VLImageConversion.Convert(
+                conversion, implementation, src, dst, pixelCount);
+            ++iterations;
+        }
+        while (stopwatch.Elapsed.TotalSeconds < minSeconds);
+        stopwatch.Stop();
+
+        return (double)src.Length * iterations /
+            stopwatch.Elapsed.TotalSeconds / 1.0e9;
+    }
+}
@@ -0,0 +1,448 @@
+using UnityEngine;
+using UnityEditor;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Threading;
+using VLWorkerCommands;
+
+/// <summary>
+///  Searches for tracking parameters with a good trade-off between speed and
+///  robustness by replaying a recorded image sequence.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The sweep can be started from the menu or in batch mode using
+///   <c>-batchmode -quit -executeMethod VLParameterSweep.Run</c>.
+///   Each parameter combination is replayed by an independent
+///   <see cref="VLReplayRunner"/>. The jobs are distributed over all cores.
+///  </para>
+///  <para>
+///   Additionally to the arguments of <see cref="VLReplayBenchmark"/>, the
+///   following command line arguments are supported:
+///   <c>-param &lt;name&gt;=&lt;value&gt;,&lt;value&gt;,...</c> (can be used
+///   multiple times and replaces the default parameters),
+///   <c>-samples &lt;count&gt;</c> (number of random combinations, 0 for
+///   the whole grid), <c>-seed &lt;seed&gt;</c>, <c>-jobs &lt;count&gt;</c>
+///   and <c>-minTrackedRatio &lt;ratio&gt;</c>.
+///  </para>
+///  <para>
+///   The results are written as JSON. A combination belongs to the Pareto
+///   front, if no other combination is both faster and tracks more frames.
+///  </para>
+///  <para>
+///   The concurrent jobs compete for the cores, so their frame rates are
+///   only used to select the candidates of the Pareto front. The candidates
+///   are replayed again one after another and the Pareto front is computed
+///   from these serial frame rates.
+///  </para>
+/// </remarks>
+public static class VLParameterSweep
+{
+    /// <summary>
+    ///  Result of a single parameter combination.
+    /// </summary>
+    [Serializable]
+    public class Job
+    {
+        /// <summary>Tracking parameters set before the replay.</summary>
+        public SetAttributeCmd.Param[] attributes;
+
+        /// <summary>
+        ///  Whether the tracker was created and the sequence was replayed.
+        /// </summary>
+        public bool succeeded;
+
+        /// <summary>
+        ///  Exception, which aborted the job, or an empty string.
+        /// </summary>
+        public string error = "";
+
+        /// <summary>
+        ///  Whether the job belongs to the Pareto front of the serial
+        ///  replays.
+        /// </summary>
+        public bool paretoOptimal;
+
+        /// <summary>
+        ///  Result of the replay, which ran concurrently with the other jobs.
+        /// </summary>
+        public VLReplayRunner.Result result;
+
+        /// <summary>
+        ///  Whether the job was replayed again without any concurrent jobs.
+        /// </summary>
+        public bool retimed;
+
+        /// <summary>
+        ///  Result of the serial replay, if <see cref="retimed"/> is
+        ///  <c>true</c>.
+        /// </summary>
+        public VLReplayRunner.Result serialResult;
+    }
+
+    /// <summary>
+    ///  Results of the parameter sweep.
+    /// </summary>
+    [Serializable]
+    public class Report
+    {
+        /// <summary>Path of the tracking configuration.</summary>
+        public string trackingConfig;
+        /// <summary>URI of the replayed image sequence.</summary>
+        public string imageSequence;
+        /// <summary>Maximum number of frames replayed per job.</summary>
+        public int frames;
+        /// <summary>
+        ///  Minimal ratio of tracked frames of the recommended job.
+        /// </summary>
+        public double minTrackedRatio;
+        /// <summary>Number of jobs running concurrently.</summary>
+        public int threads;
+        /// <summary>
+        ///  Index of the job with the highest serial frame rate, which reached
+        ///  the minimal ratio of tracked frames, or -1.
+        /// </summary>
+        public int recommendedJob = -1;
+        /// <summary>
+        ///  Indices of the jobs on the Pareto front sorted by the serial
+        ///  frame rate.
+        /// </summary>
+        public List<int> paretoFront = new List<int>();
+        /// <summary>All parameter combinations in the order of creation.</summary>
+        public List<Job> jobs = new List<Job>();
+    }
+
+    private static readonly string[,] defaultParameters = new string[,]
+    {
+        { "laplaceThreshold", "0.5,1,2" },
+        { "normalThreshold", "0.2,0.3,0.5" },
+        { "lineGradientThreshold", "30,40,50" },
+        { "lineSearchLengthInitRelative", "0.03,0.05,0.07" },
+        { "keyFrameDistance", "5,30,50" },
+        { "minInlierRatioInit", "0.6,0.7,0.8" },
+        { "minInlierRatioTracking", "0.5,0.6,0.7" }
+    };
+
+    private const int defaultSamples = 64;
+
+    [MenuItem("VisionLib/Benchmarks/Parameter Sweep")]
+    public static void Run()
+    {
+        string config = VLReplayBenchmark.GetArgument("-vlConfig",
+            "Examples/ModelTracking/MutableModelTracking/Pieces.vl");
+        string imageSequence = VLReplayBenchmark.GetArgument("-imageSequence",
+            "local_storage_dir:records/record/image_*.jpg");
+        int frames = Int32.Parse(
+            VLReplayBenchmark.GetArgument("-frames", "500"));
+        string license =
+            VLReplayBenchmark.GetArgument("-license", "license.xml");
+        string output = VLReplayBenchmark.GetArgument("-output", "");
+        int samples = Int32.Parse(VLReplayBenchmark.GetArgument("-samples",
+            defaultSamples.ToString()));
+        int seed = Int32.Parse(VLReplayBenchmark.GetArgument("-seed", "0"));
+        int threadCount = Int32.Parse(VLReplayBenchmark.GetArgument("-jobs",
+            Environment.ProcessorCount.ToString()));
+        double minTrackedRatio = Double.Parse(
+            VLReplayBenchmark.GetArgument("-minTrackedRatio", "0.9"),
+            System.Globalization.CultureInfo.InvariantCulture);
+
+        string configPath = Path.Combine(
+            Path.Combine(Application.streamingAssetsPath, "VisionLib"),
+            config);
+        string licensePath =
+            Path.Combine(Application.streamingAssetsPath, license);
+        string pluginPath = Application.dataPath +
+            Path.DirectorySeparatorChar + "Plugins" +
+            Path.DirectorySeparatorChar + VLUnitySdk.subDir;
+        string imageSequenceURI =
+            (imageSequence.Length > 0 ? imageSequence : null);
+
+        Report report = new Report();
+        report.trackingConfig = configPath;
+        report.imageSequence = imageSequence;
+        report.frames = frames;
+        report.minTrackedRatio = minTrackedRatio;
+        report.threads = Math.Max(1, threadCount);
+        foreach (SetAttributeCmd.Param[] attributes in
+            CreateCombinations(GetParameters(), samples, seed))
+        {
+            Job job = new Job();
+            job.attributes = attributes;
+            report.jobs.Add(job);
+        }
+
+        UnityEngine.Debug.Log("[vlUnitySDK] Replaying " + report.jobs.Count +
+            " parameter combinations using " + threadCount + " threads");
+
+        // Each thread takes the next job until all jobs are done
+        int nextJob = -1;
+        Thread[] threads = new Thread[report.threads];
+        for (int t = 0; t < threads.Length; ++t)
+        {
+            // Only the first thread forwards the logs, because the log
+            // listeners are global
+            bool forwardLogs = (t == 0);
+            threads[t] = new Thread(() =>
+            {
+                int index;
+                while ((index = Interlocked.Increment(ref nextJob)) <
+                    report.jobs.Count)
+                {
+                    Job job = report.jobs[index];
+                    job.result = RunJob(job, licensePath, pluginPath,
+                        configPath, imageSequenceURI, frames, forwardLogs);
+                }
+            });
+            threads[t].Start();
+        }
+        foreach (Thread thread in threads)
+        {
+            thread.Join();
+        }
+
+        // Replay the candidates without competing jobs
+        List<int> candidates = GetParetoFront(report, false);
+        UnityEngine.Debug.Log("[vlUnitySDK] Replaying " + candidates.Count +
+            " candidates of the Pareto front one after another");
+        foreach (int index in candidates)
+        {
+            Job job = report.jobs[index];
+            job.serialResult = RunJob(job, licensePath, pluginPath,
+                configPath, imageSequenceURI, frames, true);
+            job.retimed = job.succeeded;
+        }
+
+        UpdateParetoFront(report);
+        foreach (Job job in report.jobs)
+        {
+            if (job.error.Length > 0)
+            {
+                UnityEngine.Debug.LogWarning("[vlUnitySDK] Job " +
+                    GetDescription(job.attributes) + " failed: " + job.error);
+            }
+        }
+
+        string json = JsonUtility.ToJson(report, true);
+        if (output.Length > 0)
+        {
+            File.WriteAllText(output, json);
+        }
+
+        string summary = "[vlUnitySDK] Pareto front (fps, tracked ratio):\n";
+        foreach (int index in report.paretoFront)
+        {
+            summary += String.Format("  {0,8:F1} {1,6:P1}  {2}\n",
+                report.jobs[index].serialResult.framesPerSecond,
+                report.jobs[index].serialResult.trackedRatio,
+                GetDescription(report.jobs[index].attributes));
+        }
+        if (report.recommendedJob >= 0)
+        {
+            summary += "Fastest combination with at least " +
+                minTrackedRatio.ToString("P0") + " tracked frames: " +
+                GetDescription(report.jobs[report.recommendedJob].attributes);
+        }
+        else
+        {
+            summary += "No combination reached " +
+                minTrackedRatio.ToString("P0") + " tracked frames";
+        }
+        UnityEngine.Debug.Log(summary);
+    }
+
+    private static VLReplayRunner.Result RunJob(Job job, string licensePath,
+        string pluginPath, string configPath, string imageSequenceURI,
+        int frames, bool forwardLogs)
+    {
+        // A failing job must not abort the other jobs of its thread
+        try
+        {
+            using (VLReplayRunner runner = new VLReplayRunner(
+                licensePath, pluginPath, forwardLogs))
+            {
+                job.succeeded = runner.CreateTracker(configPath,
+                    imageSequenceURI, job.attributes);
+                if (job.succeeded)
+                {
+                    return runner.Run(frames);
+                }
+            }
+        }
+        catch (Exception e)
+        {
+            job.succeeded = false;
+            job.error = e.GetType().Name + ": " + e.Message;
+        }
+
+        return null;
+    }
+
+    private static List<KeyValuePair<string, string[]>> GetParameters()
+    {
+        List<KeyValuePair<string, string[]>> parameters =
+            new List<KeyValuePair<string, string[]>>();
+
+        string[] args = Environment.GetCommandLineArgs();
+        for (int i = 0; i + 1 < args.Length; ++i)
+        {
+            if (args[i] != "-param")
+            {
+                continue;
+            }
+            int separator = args[i + 1].IndexOf('=');
+            if (separator <= 0)
+            {
+                UnityEngine.Debug.LogWarning(
+                    "[vlUnitySDK] Ignoring invalid parameter '" +
+                    args[i + 1] + "'");
+                continue;
+            }
+            parameters.Add(new KeyValuePair<string, string[]>(
+                args[i + 1].Substring(0, separator),
+                args[i + 1].Substring(separator + 1).Split(',')));
+        }
+
+        if (parameters.Count == 0)
+        {
+            for (int i = 0; i < defaultParameters.GetLength(0); ++i)
+            {
+                parameters.Add(new KeyValuePair<string, string[]>(
+                    defaultParameters[i, 0],
+                    defaultParameters[i, 1].Split(',')));
+            }
+        }
+
+        return parameters;
+    }
+
+    private static List<SetAttributeCmd.Param[]> CreateCombinations(
+        List<KeyValuePair<string, string[]>> parameters, int samples, int seed)
+    {
+        long gridSize = 1;
+        foreach (KeyValuePair<string, string[]> parameter in parameters)
+        {
+            gridSize *= parameter.Value.Length;
+        }
+
+        // Each combination is identified by its index in the grid. A random
+        // search samples distinct indices.
+        List<long> indices = new List<long>();
+        if (samples <= 0 || samples >= gridSize)
+        {
+            for (long i = 0; i < gridSize; ++i)
+            {
+                indices.Add(i);
+            }
+        }
+        else
+        {
+            System.Random random = new System.Random(seed);
+            HashSet<long> selected = new HashSet<long>();
+            while (selected.Count < samples)
+            {
+                long index = (long)(random.NextDouble() * gridSize);
+                if (selected.Add(index))
+                {
+                    indices.Add(index);
+                }
+            }
+        }
+
+        List<SetAttributeCmd.Param[]> combinations =
+            new List<SetAttributeCmd.Param[]>();
+        foreach (long index in indices)
+        {
+            SetAttributeCmd.Param[] attributes =
+                new SetAttributeCmd.Param[parameters.Count];
+            long remainder = index;
+            for (int p = 0; p < parameters.Count; ++p)
+            {
+                string[] values = parameters[p].Value;
+                attributes[p] = new SetAttributeCmd.Param(parameters[p].Key,
+                    values[remainder % values.Length]);
+                remainder /= values.Length;
+            }
+            combinations.Add(attributes);
+        }
+
+        return combinations;
+    }
+
+    private static VLReplayRunner.Result GetResult(Job job, bool serial)
+    {
+        if (serial ? !job.retimed : !job.succeeded)
+        {
+            return null;
+        }
+        VLReplayRunner.Result result = (serial ? job.serialResult : job.result);
+        return (result != null && result.frames > 0 ? result : null);
+    }
+
+    private static List<int> GetParetoFront(Report report, bool serial)
+    {
+        List<int> front = new List<int>();
+        for (int i = 0; i < report.jobs.Count; ++i)
+        {
+            VLReplayRunner.Result a = GetResult(report.jobs[i], serial);
+            if (a == null)
+            {
+                continue;
+            }
+
+            bool dominated = false;
+            for (int j = 0; j < report.jobs.Count && !dominated; ++j)
+            {
+                VLReplayRunner.Result b = GetResult(report.jobs[j], serial);
+                if (j == i || b == null)
+                {
+                    continue;
+                }
+                dominated =
+                    b.framesPerSecond >= a.framesPerSecond &&
+                    b.trackedRatio >= a.trackedRatio &&
+                    (b.framesPerSecond > a.framesPerSecond ||
+                     b.trackedRatio > a.trackedRatio);
+            }
+            if (!dominated)
+            {
+                front.Add(i);
+            }
+        }
+
+        return front;
+    }
+
+    private static void UpdateParetoFront(Report report)
+    {
+        report.paretoFront = GetParetoFront(report, true);
+        report.recommendedJob = -1;
+        double recommendedFps = -1.0;
+        foreach (int i in report.paretoFront)
+        {
+            VLReplayRunner.Result result = report.jobs[i].serialResult;
+            report.jobs[i].paretoOptimal = true;
+            if (result.trackedRatio >= report.minTrackedRatio &&
+                result.framesPerSecond > recommendedFps)
+            {
+                recommendedFps = result.framesPerSecond;
+                report.recommendedJob = i;
+            }
+        }
+
+        report.paretoFront.Sort((a, b) =>
+            report.jobs[b].serialResult.framesPerSecond.CompareTo(
+                report.jobs[a].serialResult.framesPerSecond));
+    }
+
+    private static string GetDescription(SetAttributeCmd.Param[] attributes)
+    {
+        string description = "";
+        foreach (SetAttributeCmd.Param attribute in attributes)
+        {
+            description += (description.Length > 0 ? ", " : "") +
+                attribute.att + "=" + attribute.val;
+        }
+        return description;
+    }
+}
@@ -0,0 +1,121 @@
+using UnityEngine;
+using UnityEditor;
+using System;
+using System.IO;
+
+/// <summary>
+///  Replays a recorded image sequence through the model tracker and reports
+///  the throughput, the processing time and the tracking quality.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The benchmark can be started from the menu or in batch mode using
+///   <c>-batchmode -quit -executeMethod VLReplayBenchmark.Run</c>.
+///  </para>
+///  <para>
+///   The following command line arguments are supported:
+///   <c>-vlConfig &lt;file&gt;</c> (relative to StreamingAssets/VisionLib),
+///   <c>-imageSequence &lt;uri&gt;</c>, <c>-frames &lt;count&gt;</c>,
+///   <c>-license &lt;file&gt;</c> (relative to StreamingAssets),
+///   <c>-groundTruth &lt;file&gt;</c>, <c>-output &lt;file&gt;</c>,
+///   <c>-workerThreads &lt;count&gt;</c> and
+///   <c>-workerAffinity &lt;mask&gt;</c> (see <see cref="VLWorkerOptions"/>).
+///   The results are written as JSON.
+///  </para>
+///  <para>
+///   The images can be recorded with the
+///   Examples/ImageRecorder/imageRecorder.vl tracking configuration or
+///   rendered with the <see cref="VLSyntheticSequenceGenerator"/>, which
+///   also writes the ground truth poses for measuring the accuracy.
+///  </para>
+/// </remarks>
+public static class VLReplayBenchmark
+{
+    private const string defaultConfig =
+        "Examples/ModelTracking/MutableModelTracking/Pieces.vl";
+    private const string defaultImageSequence =
+        "local_storage_dir:records/record/image_*.jpg";
+    private const int defaultFrames = 500;
+
+    [MenuItem("VisionLib/Benchmarks/Replay")]
+    public static void Run()
+    {
+        string config = GetArgument("-vlConfig", defaultConfig);
+        string imageSequence =
+            GetArgument("-imageSequence", defaultImageSequence);
+        int frames = Int32.Parse(
+            GetArgument("-frames", defaultFrames.ToString()));
+        string license = GetArgument("-license", "license.xml");
+        string output = GetArgument("-output", "");
+        string groundTruth = GetArgument("-groundTruth", "");
+        VLWorkerOptions workerOptions = new VLWorkerOptions();
+        workerOptions.threadCount = Int32.Parse(GetArgument("-workerThreads",
+            workerOptions.threadCount.ToString()));
+        workerOptions.affinityMask = GetArgument("-workerAffinity",
+            workerOptions.affinityMask);
+
+        string configPath = Path.Combine(
+            Path.Combine(Application.streamingAssetsPath, "VisionLib"),
+            config);
+        string licensePath =
+            Path.Combine(Application.streamingAssetsPath, license);
+        string pluginPath = Application.dataPath +
+            Path.DirectorySeparatorChar + "Plugins" +
+            Path.DirectorySeparatorChar + VLUnitySdk.subDir;
+
+        VLReplayRunner.Result result;
+        using (VLReplayRunner runner = new VLReplayRunner(licensePath,
+            pluginPath, true, workerOptions))
+        {
+            if (!runner.CreateTracker(configPath,
+                (imageSequence.Length > 0 ? imageSequence : null)))
+            {
+                UnityEngine.Debug.LogError(
+                    "[vlUnitySDK] Failed to start the replay of '" +
+                    configPath + "'");
+                if (Application.isBatchMode)
+                {
+                    EditorApplication.Exit(1);
+                }
+                return;
+            }
+            if (groundTruth.Length > 0)
+            {
+                runner.SetGroundTruth(JsonUtility.FromJson<VLGroundTruth>(
+                    File.ReadAllText(groundTruth)));
+            }
+            result = runner.Run(frames);
+        }
+
+        string json = JsonUtility.ToJson(result, true);
+        if (output.Length > 0)
+        {
+            File.WriteAllText(output, json);
+        }
+
+        UnityEngine.Debug.Log(String.Format(
+            "[vlUnitySDK] Replay of {0} frames: {1:F1} fps, " +
+            "latency p50/p95/p99/max {2:F2}/{3:F2}/{4:F2}/{5:F2} ms, " +
+            "tracked/critical/lost {6:P1}/{7:P1}/{8:P1}, " +
+            "jitter {9:G3}/{10:F3}deg, hash {11}\n{12}",
+            result.frames, result.framesPerSecond,
+            result.latencyP50, result.latencyP95, result.latencyP99,
+            result.latencyMax,
+            result.trackedRatio, result.criticalRatio, result.lostRatio,
+            result.translationJitter, result.rotationJitter,
+            result.resultHash, json));
+    }
+
+    internal static string GetArgument(string name, string defaultValue)
+    {
+        string[] args = Environment.GetCommandLineArgs();
+        for (int i = 0; i + 1 < args.Length; ++i)
+        {
+            if (args[i] == name)
+            {
+                return args[i + 1];
+            }
+        }
+        return defaultValue;
+    }
+}
@@ -0,0 +1,413 @@
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+
+/// <summary>
+///  Minimal CPU rasterizer for rendering synthetic camera images of OBJ
+///  models.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The camera uses the computer vision convention of the VisionLib
+///   (x right, y down, z forward). A point X of the model is transformed
+///   into the camera coordinate system by R * X + t.
+///  </para>
+///  <para>
+///   Triangles are rendered two-sided with flat shading and a z-buffer.
+///   Triangles, which are partially behind the near plane, are skipped.
+///  </para>
+/// </remarks>
+public class VLSoftwareRasterizer
+{
+    /// <summary>
+    ///  Triangle mesh loaded from an OBJ file.
+    /// </summary>
+    public class Mesh
+    {
+        /// <summary>Vertex positions (x, y, z).</summary>
+        public List<float> vertices = new List<float>();
+        /// <summary>Vertex indices of the triangles.</summary>
+        public List<int> triangles = new List<int>();
+
+        /// <summary>
+        ///  Loads the vertices and faces of an OBJ file.
+        /// </summary>
+        /// <remarks>
+        ///  Texture coordinates, normals and materials are ignored. Polygons
+        ///  are split into triangle fans.
+        /// </remarks>
+        /// <param name="path">Path of the OBJ file.</param>
+        /// <param name="scale">Scale applied to the vertices.</param>
+        public void LoadObj(string path, float scale)
+        {
+            int firstVertex = this.vertices.Count / 3;
+            char[] separators = new char[] { ' ', '\t' };
+            List<int> face = new List<int>();
+
+            foreach (string line in File.ReadAllLines(path))
+            {
+                string[] tokens = line.Split(separators,
+                    StringSplitOptions.RemoveEmptyEntries);
+                if (tokens.Length < 4)
+                {
+                    continue;
+                }
+
+                if (tokens[0] == "v")
+                {
+                    for (int i = 1; i <= 3; ++i)
+                    {
+                        this.vertices.Add(scale * Single.Parse(tokens[i],
+                            CultureInfo.InvariantCulture));
+                    }
+                }
+                else if (tokens[0] == "f")
+                {
+                    int vertexCount = this.vertices.Count / 3;
+                    face.Clear();
+                    for (int i = 1; i < tokens.Length; ++i)
+                    {
+                        // Only the position index before the first '/' is used
+                        int slash = tokens[i].IndexOf('/');
+                        int index = Int32.Parse(slash < 0 ?
+                            tokens[i] : tokens[i].Substring(0, slash),
+                            CultureInfo.InvariantCulture);
+                        // Negative indices are relative to the last vertex
+                        face.Add(index < 0 ?
+                            vertexCount + index : firstVertex + index - 1);
+                    }
+                    for (int i = 2; i < face.Count; ++i)
+                    {
+                        this.triangles.Add(face[0]);
+                        this.triangles.Add(face[i - 1]);
+                        this.triangles.Add(face[i]);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        ///  Computes the center and the radius of the bounding box.
+        /// </summary>
+        public void GetBounds(float[] center, out float radius)
+        {
+            float[] min = new float[] { Single.MaxValue, Single.MaxValue, Single.MaxValue };
+            float[] max = new float[] { Single.MinValue, Single.MinValue, Single.MinValue };
+            for (int i = 0; i < this.vertices.Count; ++i)
+            {
+                min[i % 3] = Math.Min(min[i % 3], this.vertices[i]);
+                max[i % 3] = Math.Max(max[i % 3], this.vertices[i]);
+            }
+
+            float squaredRadius = 0.0f;
+            for (int i = 0; i < 3; ++i)
+            {
+                center[i] = 0.5f * (min[i] + max[i]);
+                float halfSize = 0.5f * (max[i] - min[i]);
+                squaredRadius += halfSize * halfSize;
+            }
+            radius = (float)Math.Sqrt(squaredRadius);
+        }
+    }
+
+    private const double nearPlane = 0.001;
+
+    private int width;
+    private int height;
+    private double fx;
+    private double fy;
+    private double cx;
+    private double cy;
+    private byte[] pixels;
+    private float[] inverseDepth;
+
+    // Transformed vertices (camera coordinates and image coordinates)
+    private double[] cameraVertices = new double[0];
+    private double[] imageVertices = new double[0];
+
+    /// <summary>
+    ///  Constructor of VLSoftwareRasterizer.
+    /// </summary>
+    /// <param name="width">Width of the image in pixels.</param>
+    /// <param name="height">Height of the image in pixels.</param>
+    /// <param name="fx">Focal length in x direction in pixels.</param>
+    /// <param name="fy">Focal length in y direction in pixels.</param>
+    /// <param name="cx">Principal point in x direction in pixels.</param>
+    /// <param name="cy">Principal point in y direction in pixels.</param>
+    public VLSoftwareRasterizer(int width, int height, double fx, double fy,
+        double cx, double cy)
+    {
+        this.width = width;
+        this.height = height;
+        this.fx = fx;
+        this.fy = fy;
+        this.cx = cx;
+        this.cy = cy;
+        this.pixels = new byte[width * height * 3];
+        this.inverseDepth = new float[width * height];
+    }
+
+    /// <summary>
+    ///  Returns the RGB pixels of the image. The first row is the top row.
+    /// </summary>
+    public byte[] GetPixels()
+    {
+        return this.pixels;
+    }
+
+    /// <summary>
+    ///  Fills the image with a color and clears the z-buffer.
+    /// </summary>
+    public void Clear(byte r, byte g, byte b)
+    {
+        for (int i = 0; i < this.pixels.Length; i += 3)
+        {
+            this.pixels[i] = r;
+            this.pixels[i + 1] = g;
+            this.pixels[i + 2] = b;
+        }
+        Array.Clear(this.inverseDepth, 0, this.inverseDepth.Length);
+    }
+
+    /// <summary>
+    ///  Renders a mesh.
+    /// </summary>
+    /// <param name="mesh">Mesh to render.</param>
+    /// <param name="rotation">
+    ///  Rotation from the model into the camera coordinate system as 3x3
+    ///  matrix in row-major order.
+    /// </param>
+    /// <param name="translation">
+    ///  Translation from the model into the camera coordinate system.
+    /// </param>
+    /// <param name="color">RGB color of the mesh.</param>
+    /// <param name="ambient">Intensity of the ambient light.</param>
+    /// <param name="diffuse">
+    ///  Intensity of the directional light, which shines along the viewing
+    ///  direction of the camera.
+    /// </param>
+    public void DrawMesh(Mesh mesh, double[] rotation, double[] translation,
+        byte[] color, double ambient, double diffuse)
+    {
+        int vertexCount = mesh.vertices.Count / 3;
+        if (this.cameraVertices.Length < vertexCount * 3)
+        {
+            this.cameraVertices = new double[vertexCount * 3];
+            this.imageVertices = new double[vertexCount * 2];
+        }
+
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            double x = mesh.vertices[3 * v];
+            double y = mesh.vertices[3 * v + 1];
+            double z = mesh.vertices[3 * v + 2];
+            for (int i = 0; i < 3; ++i)
+            {
+                this.cameraVertices[3 * v + i] = rotation[3 * i] * x +
+                    rotation[3 * i + 1] * y + rotation[3 * i + 2] * z +
+                    translation[i];
+            }
+            double depth = this.cameraVertices[3 * v + 2];
+            this.imageVertices[2 * v] =
+                this.fx * this.cameraVertices[3 * v] / depth + this.cx;
+            this.imageVertices[2 * v + 1] =
+                this.fy * this.cameraVertices[3 * v + 1] / depth + this.cy;
+        }
+
+        for (int i = 0; i + 2 < mesh.triangles.Count; i += 3)
+        {
+            DrawTriangle(mesh.triangles[i], mesh.triangles[i + 1],
+                mesh.triangles[i + 2], color, ambient, diffuse);
+        }
+    }
+
+    /// <summary>
+    ///  Fills a rectangle in front of all rendered objects.
+    /// </summary>
+    public void FillRect(int x0, int y0, int x1, int y1, byte r, byte g, byte b)
+    {
+        x0 = Math.Max(0, x0);
+        y0 = Math.Max(0, y0);
+        x1 = Math.Min(this.width, x1);
+        y1 = Math.Min(this.height, y1);
+        for (int y = y0; y < y1; ++y)
+        {
+            for (int x = x0; x < x1; ++x)
+            {
+                int index = y * this.width + x;
+                this.pixels[3 * index] = r;
+                this.pixels[3 * index + 1] = g;
+                this.pixels[3 * index + 2] = b;
+                this.inverseDepth[index] = Single.MaxValue;
+            }
+        }
+    }
+
+    private void DrawTriangle(int a, int b, int c, byte[] color,
+        double ambient, double diffuse)
+    {
+        double za = this.cameraVertices[3 * a + 2];
+        double zb = this.cameraVertices[3 * b + 2];
+        double zc = this.cameraVertices[3 * c + 2];
+        if (za < nearPlane || zb < nearPlane || zc < nearPlane)
+        {
+            return;
+        }
+
+        double xa = this.imageVertices[2 * a];
+        double ya = this.imageVertices[2 * a + 1];
+        double xb = this.imageVertices[2 * b];
+        double yb = this.imageVertices[2 * b + 1];
+        double xc = this.imageVertices[2 * c];
+        double yc = this.imageVertices[2 * c + 1];
+
+        double area = (xb - xa) * (yc - ya) - (xc - xa) * (yb - ya);
+        if (area == 0.0)
+        {
+            return;
+        }
+
+        int minX = Math.Max(0, (int)Math.Floor(Math.Min(xa, Math.Min(xb, xc))));
+        int maxX = Math.Min(this.width - 1,
+            (int)Math.Ceiling(Math.Max(xa, Math.Max(xb, xc))));
+        int minY = Math.Max(0, (int)Math.Floor(Math.Min(ya, Math.Min(yb, yc))));
+        int maxY = Math.Min(this.height - 1,
+            (int)Math.Ceiling(Math.Max(ya, Math.Max(yb, yc))));
+        if (minX > maxX || minY > maxY)
+        {
+            return;
+        }
+
+        // Two-sided Lambert shading with the face normal
+        double[] n = GetFaceNormal(a, b, c);
+        double intensity = Math.Min(1.0, ambient + diffuse * Math.Abs(n[2]));
+        byte r = (byte)(color[0] * intensity);
+        byte g = (byte)(color[1] * intensity);
+        byte bl = (byte)(color[2] * intensity);
+
+        double inverseArea = 1.0 / area;
+        double wa = 1.0 / za;
+        double wb = 1.0 / zb;
+        double wc = 1.0 / zc;
+        for (int y = minY; y <= maxY; ++y)
+        {
+            double py = y + 0.5;
+            for (int x = minX; x <= maxX; ++x)
+            {
+                double px = x + 0.5;
+                // Barycentric coordinates from the edge functions
+                double la = ((xb - px) * (yc - py) - (xc - px) * (yb - py)) * inverseArea;
+                double lb = ((xc - px) * (ya - py) - (xa - px) * (yc - py)) * inverseArea;
+                double lc = 1.0 - la - lb;
+                if (la < 0.0 || lb < 0.0 || lc < 0.0)
+                {
+                    continue;
+                }
+
+                // The inverse depth can be interpolated linearly in image space
+                float w = (float)(la * wa + lb * wb + lc * wc);
+                int index = y * this.width + x;
+                if (w <= this.inverseDepth[index])
+                {
+                    continue;
+                }
+                this.inverseDepth[index] = w;
+                this.pixels[3 * index] = r;
+                this.pixels[3 * index + 1] = g;
+                this.pixels[3 * index + 2] = bl;
+            }
+        }
+    }
+
+    private double[] GetFaceNormal(int a, int b, int c)
+    {
+        double[] u = new double[3];
+        double[] v = new double[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            u[i] = this.cameraVertices[3 * b + i] - this.cameraVertices[3 * a + i];
+            v[i] = this.cameraVertices[3 * c + i] - this.cameraVertices[3 * a + i];
+        }
+        double[] n = new double[]
+        {
+            u[1] * v[2] - u[2] * v[1],
+            u[2] * v[0] - u[0] * v[2],
+            u[0] * v[1] - u[1] * v[0]
+        };
+        double length = Math.Sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (length > 0.0)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                n[i] /= length;
+            }
+        }
+        return n;
+    }
+
+    /// <summary>
+    ///  Blurs the image with a box filter.
+    /// </summary>
+    /// <param name="radius">Radius of the filter in pixels.</param>
+    public void BoxBlur(int radius)
+    {
+        if (radius <= 0)
+        {
+            return;
+        }
+
+        byte[] temp = new byte[this.pixels.Length];
+        BoxBlurPass(this.pixels, temp, radius, 3, 3 * this.width,
+            this.width, this.height);
+        BoxBlurPass(temp, this.pixels, radius, 3 * this.width, 3,
+            this.height, this.width);
+    }
+
+    private static void BoxBlurPass(byte[] src, byte[] dst, int radius,
+        int step, int lineStep, int length, int lineCount)
+    {
+        for (int line = 0; line < lineCount; ++line)
+        {
+            for (int channel = 0; channel < 3; ++channel)
+            {
+                int offset = line * lineStep + channel;
+                for (int i = 0; i < length; ++i)
+                {
+                    int first = Math.Max(0, i - radius);
+                    int last = Math.Min(length - 1, i + radius);
+                    int sum = 0;
+                    for (int j = first; j <= last; ++j)
+                    {
+                        sum += src[offset + j * step];
+                    }
+                    dst[offset + i * step] = (byte)(sum / (last - first + 1));
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    ///  Adds gaussian noise to the image.
+    /// </summary>
+    /// <param name="random">Random number generator.</param>
+    /// <param name="sigma">Standard deviation of the noise.</param>
+    public void AddNoise(Random random, double sigma)
+    {
+        if (sigma <= 0.0)
+        {
+            return;
+        }
+
+        for (int i = 0; i < this.pixels.Length; ++i)
+        {
+            // Box-Muller transform
+            double u1 = 1.0 - random.NextDouble();
+            double u2 = random.NextDouble();
+            double noise = sigma * Math.Sqrt(-2.0 * Math.Log(u1)) *
+                Math.Cos(2.0 * Math.PI * u2);
+            this.pixels[i] = (byte)Math.Max(0.0,
+                Math.Min(255.0, this.pixels[i] + noise + 0.5));
+        }
+    }
+}
@@ -0,0 +1,520 @@
+using UnityEngine;
+using UnityEditor;
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+
+/// <summary>
+///  Renders synthetic image sequences of OBJ models with exact ground truth
+///  poses.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The generator can be started from the menu or in batch mode using
+///   <c>-batchmode -quit -executeMethod VLSyntheticSequenceGenerator.Run</c>.
+///   The images are written as image_00000.jpg, image_00001.jpg, ... like
+///   the images of the imageRecorder and can be replayed using an
+///   imageSequence input. The poses and the intrinsic camera parameters are
+///   written to groundTruth.json (see <see cref="VLGroundTruth"/>).
+///  </para>
+///  <para>
+///   The intrinsic camera parameters are also written as camera calibration
+///   to calibration.json. The generated tracking configuration tracking.vl
+///   tracks the rendered models in the image sequence and references the
+///   calibration via <c>intrinsicsDBURI</c> and the <c>deviceID</c> of the
+///   input. Therefore the replay uses the exact intrinsics instead of a
+///   default calibration.
+///  </para>
+///  <para>
+///   The following command line arguments are supported:
+///   <c>-models &lt;file&gt;,&lt;file&gt;,...</c> (relative to
+///   Assets/Models/Meccano), <c>-output &lt;directory&gt;</c>,
+///   <c>-frames &lt;count&gt;</c>, <c>-width &lt;pixels&gt;</c>,
+///   <c>-height &lt;pixels&gt;</c>, <c>-fov &lt;degrees&gt;</c> (horizontal),
+///   <c>-modelScale &lt;scale&gt;</c>, <c>-format jpg|png|ppm</c> and
+///   <c>-seed &lt;seed&gt;</c>. PPM images can be replayed by the vlSDK
+///   stand-in in PIlot/Tools/vlSDKStandIn.
+///  </para>
+///  <para>
+///   By default the camera orbits around the models. The orbit is
+///   controlled by <c>-distance &lt;distance&gt;</c> (0 for fitting the
+///   models into the image), <c>-elevation &lt;degrees&gt;</c> and
+///   <c>-degreesPerFrame &lt;degrees&gt;</c>. Alternatively the poses can
+///   be read from an existing ground truth file using
+///   <c>-trajectory &lt;file&gt;</c>.
+///  </para>
+///  <para>
+///   Image degradations: <c>-noise &lt;sigma&gt;</c>,
+///   <c>-blur &lt;radius&gt;</c>, <c>-motionBlurSamples &lt;count&gt;</c>
+///   (orbit only), <c>-lightingVariation &lt;0..1&gt;</c> and
+///   <c>-occluder</c> (a bar moving through the image).
+///  </para>
+/// </remarks>
+public static class VLSyntheticSequenceGenerator
+{
+    private static readonly byte[][] modelColors = new byte[][]
+    {
+        new byte[] { 200, 200, 205 },
+        new byte[] { 220, 180, 60 },
+        new byte[] { 90, 150, 220 },
+        new byte[] { 200, 90, 80 },
+        new byte[] { 110, 190, 110 }
+    };
+
+    private const double ambient = 0.35;
+    private const double diffuse = 0.65;
+    private const byte background = 60;
+    private const int lightingPeriod = 90;
+    private const string deviceID = "VLSyntheticCamera";
+
+    [MenuItem("VisionLib/Benchmarks/Generate Synthetic Sequence")]
+    public static void Run()
+    {
+        string models = VLReplayBenchmark.GetArgument("-models", "p1_grid.obj");
+        string output = VLReplayBenchmark.GetArgument("-output",
+            Path.Combine(Application.persistentDataPath, "records/synthetic"));
+        int frames = Int32.Parse(VLReplayBenchmark.GetArgument("-frames", "300"));
+        int width = Int32.Parse(VLReplayBenchmark.GetArgument("-width", "640"));
+        int height = Int32.Parse(VLReplayBenchmark.GetArgument("-height", "480"));
+        double fov = GetDouble("-fov", 60.0);
+        float modelScale = (float)GetDouble("-modelScale", 0.01);
+        string format = VLReplayBenchmark.GetArgument("-format", "jpg");
+        int seed = Int32.Parse(VLReplayBenchmark.GetArgument("-seed", "0"));
+        double distance = GetDouble("-distance", 0.0);
+        double elevation = GetDouble("-elevation", 30.0);
+        double degreesPerFrame = GetDouble("-degreesPerFrame", 1.0);
+        string trajectory = VLReplayBenchmark.GetArgument("-trajectory", "");
+        double noise = GetDouble("-noise", 0.0);
+        int blur = Int32.Parse(VLReplayBenchmark.GetArgument("-blur", "0"));
+        int motionBlurSamples = Int32.Parse(
+            VLReplayBenchmark.GetArgument("-motionBlurSamples", "1"));
+        double lightingVariation = GetDouble("-lightingVariation", 0.0);
+        bool occluder =
+            Array.IndexOf(Environment.GetCommandLineArgs(), "-occluder") >= 0;
+
+        // Load the models into separate meshes for coloring them differently
+        string modelDir = Path.Combine(Application.dataPath, "Models/Meccano");
+        List<VLSoftwareRasterizer.Mesh> meshes =
+            new List<VLSoftwareRasterizer.Mesh>();
+        VLSoftwareRasterizer.Mesh allMeshes = new VLSoftwareRasterizer.Mesh();
+        foreach (string model in models.Split(','))
+        {
+            VLSoftwareRasterizer.Mesh mesh = new VLSoftwareRasterizer.Mesh();
+            mesh.LoadObj(Path.Combine(modelDir, model.Trim()), modelScale);
+            meshes.Add(mesh);
+            allMeshes.vertices.AddRange(mesh.vertices);
+        }
+
+        float[] center = new float[3];
+        float radius;
+        allMeshes.GetBounds(center, out radius);
+
+        VLGroundTruth groundTruth = new VLGroundTruth();
+        groundTruth.intrinsics = new VLGroundTruth.Intrinsics();
+        groundTruth.intrinsics.width = width;
+        groundTruth.intrinsics.height = height;
+        double focalLength = 0.5 * width / Math.Tan(0.5 * fov * Math.PI / 180.0);
+        groundTruth.intrinsics.fxNorm = (float)(focalLength / width);
+        groundTruth.intrinsics.fyNorm = (float)(focalLength / height);
+        groundTruth.intrinsics.cxNorm = 0.5f;
+        groundTruth.intrinsics.cyNorm = 0.5f;
+
+        VLGroundTruth.Pose[] trajectoryPoses = null;
+        if (trajectory.Length > 0)
+        {
+            trajectoryPoses = JsonUtility.FromJson<VLGroundTruth>(
+                File.ReadAllText(trajectory)).poses;
+            frames = Math.Min(frames, trajectoryPoses.Length);
+            if (motionBlurSamples > 1)
+            {
+                UnityEngine.Debug.LogWarning("[vlUnitySDK] Motion blur is " +
+                    "only supported for the orbit trajectory");
+                motionBlurSamples = 1;
+            }
+        }
+        if (distance <= 0.0)
+        {
+            // Fit the bounding sphere into the vertical field of view
+            distance = 1.2 * radius * focalLength / (0.5 * height);
+        }
+
+        Directory.CreateDirectory(output);
+        VLSoftwareRasterizer rasterizer = new VLSoftwareRasterizer(width,
+            height, focalLength, focalLength, 0.5 * width, 0.5 * height);
+        System.Random random = new System.Random(seed);
+        int[] accumulator = new int[width * height * 3];
+        byte[] flipped = new byte[width * height * 3];
+        Texture2D texture =
+            new Texture2D(width, height, TextureFormat.RGB24, false);
+        groundTruth.poses = new VLGroundTruth.Pose[frames];
+
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            double light = 1.0 + lightingVariation *
+                Math.Sin(2.0 * Math.PI * frame / lightingPeriod);
+
+            double[] rotation = new double[9];
+            double[] translation = new double[3];
+            Array.Clear(accumulator, 0, accumulator.Length);
+            for (int sample = 0; sample < motionBlurSamples; ++sample)
+            {
+                if (trajectoryPoses != null)
+                {
+                    GetRotationMatrix(trajectoryPoses[frame].q, rotation);
+                    for (int i = 0; i < 3; ++i)
+                    {
+                        translation[i] = trajectoryPoses[frame].t[i];
+                    }
+                }
+                else
+                {
+                    // The samples are distributed around the pose of the
+                    // frame, which is also the ground truth
+                    double offset = (motionBlurSamples > 1 ?
+                        (double)sample / (motionBlurSamples - 1) - 0.5 : 0.0);
+                    GetOrbitPose(center, distance, elevation,
+                        (frame + offset) * degreesPerFrame, rotation,
+                        translation);
+                }
+
+                rasterizer.Clear(background, background, background);
+                for (int m = 0; m < meshes.Count; ++m)
+                {
+                    rasterizer.DrawMesh(meshes[m], rotation, translation,
+                        modelColors[m % modelColors.Length], ambient * light,
+                        diffuse * light);
+                }
+                byte[] pixels = rasterizer.GetPixels();
+                for (int i = 0; i < pixels.Length; ++i)
+                {
+                    accumulator[i] += pixels[i];
+                }
+            }
+
+            if (trajectoryPoses == null && motionBlurSamples > 1)
+            {
+                GetOrbitPose(center, distance, elevation,
+                    frame * degreesPerFrame, rotation, translation);
+            }
+
+            VLGroundTruth.Pose pose = new VLGroundTruth.Pose();
+            pose.image = String.Format("image_{0:D5}.{1}", frame, format);
+            pose.t = new float[3];
+            for (int i = 0; i < 3; ++i)
+            {
+                pose.t[i] = (float)translation[i];
+            }
+            pose.q = GetQuaternion(rotation);
+            groundTruth.poses[frame] = pose;
+
+            // Copy the averaged samples back and apply the degradations
+            byte[] image = rasterizer.GetPixels();
+            for (int i = 0; i < image.Length; ++i)
+            {
+                image[i] = (byte)(accumulator[i] / motionBlurSamples);
+            }
+            if (occluder)
+            {
+                int barWidth = width / 8;
+                int x = (int)((long)(width + barWidth) * frame / frames) -
+                    barWidth;
+                rasterizer.FillRect(x, 0, x + barWidth, height, 30, 30, 35);
+            }
+            rasterizer.BoxBlur(blur);
+            rasterizer.AddNoise(random, noise);
+
+            if (format == "ppm")
+            {
+                WritePpm(Path.Combine(output, pose.image), image, width,
+                    height);
+                continue;
+            }
+
+            // Textures store the bottom row first
+            for (int y = 0; y < height; ++y)
+            {
+                Buffer.BlockCopy(image, y * width * 3, flipped,
+                    (height - 1 - y) * width * 3, width * 3);
+            }
+            texture.LoadRawTextureData(flipped);
+            texture.Apply();
+            File.WriteAllBytes(Path.Combine(output, pose.image),
+                format == "png" ? texture.EncodeToPNG() :
+                    texture.EncodeToJPG(95));
+        }
+        UnityEngine.Object.DestroyImmediate(texture);
+
+        string groundTruthPath = Path.Combine(output, "groundTruth.json");
+        File.WriteAllText(groundTruthPath,
+            JsonUtility.ToJson(groundTruth, true));
+        string calibrationPath = Path.Combine(output, "calibration.json");
+        File.WriteAllText(calibrationPath,
+            GetCalibration(groundTruth.intrinsics));
+        string configPath = Path.Combine(output, "tracking.vl");
+        File.WriteAllText(configPath, GetTrackingConfig(modelDir, models,
+            modelScale, groundTruth.poses[0],
+            Path.Combine(output, "image_*." + format), calibrationPath,
+            groundTruthPath));
+
+        UnityEngine.Debug.Log("[vlUnitySDK] Rendered " + frames +
+            " images to '" + output + "'. Use '-vlConfig " + configPath +
+            " -imageSequence \"\"' for the replay.");
+    }
+
+    /// <summary>
+    ///  Creates a camera calibration database, which contains the intrinsics
+    ///  for the <see cref="deviceID"/>.
+    /// </summary>
+    private static string GetCalibration(VLGroundTruth.Intrinsics intrinsics)
+    {
+        VLCameraCalibration calibration = new VLCameraCalibration();
+        calibration.version = 1;
+        calibration.deviceID = deviceID;
+        calibration.cameraName = "Synthetic camera";
+        calibration.calibrated = true;
+        calibration.intrinsics = new VLCameraCalibration.VLCameraIntrinsics();
+        calibration.intrinsics.width = intrinsics.width;
+        calibration.intrinsics.height = intrinsics.height;
+        calibration.intrinsics.fx = intrinsics.fxNorm;
+        calibration.intrinsics.fy = intrinsics.fyNorm;
+        calibration.intrinsics.cx = intrinsics.cxNorm;
+        calibration.intrinsics.cy = intrinsics.cyNorm;
+        calibration.intrinsics.quality = "synthetic";
+        calibration.intrinsics.deviceID = deviceID;
+        // The images are rendered without lens distortion
+        calibration.intrinsicsDist = calibration.intrinsics;
+        calibration.alternativeDeviceIDs = new string[0];
+
+        // The database maps the device IDs to the calibrations
+        return "{\n\"" + deviceID + "\": " +
+            JsonUtility.ToJson(calibration, true) + "\n}\n";
+    }
+
+    /// <summary>
+    ///  Creates a model tracking configuration for the rendered models, which
+    ///  replays the image sequence with the calibration of the generator.
+    /// </summary>
+    private static string GetTrackingConfig(string modelDir, string models,
+        float modelScale, VLGroundTruth.Pose initPose,
+        string imageSequenceURI, string calibrationPath,
+        string groundTruthPath)
+    {
+        string metric;
+        if (modelScale == 1.0f)
+        {
+            metric = "m";
+        }
+        else if (modelScale == 0.01f)
+        {
+            metric = "cm";
+        }
+        else if (modelScale == 0.001f)
+        {
+            metric = "mm";
+        }
+        else
+        {
+            UnityEngine.Debug.LogWarning("[vlUnitySDK] The model scale " +
+                modelScale + " has no metric. The tracking configuration " +
+                "uses the unscaled models.");
+            metric = "m";
+        }
+
+        string modelList = "";
+        string[] modelFiles = models.Split(',');
+        for (int i = 0; i < modelFiles.Length; ++i)
+        {
+            string name = Path.GetFileNameWithoutExtension(modelFiles[i].Trim());
+            modelList += "        {\"name\": \"" + name + "\", \"uri\": \"" +
+                GetJsonPath(Path.Combine(modelDir, modelFiles[i].Trim())) +
+                "\", \"enabled\": true}" +
+                (i + 1 < modelFiles.Length ? ",\n" : "\n");
+        }
+
+        string config =
+            "{\n" +
+            "  \"type\": \"VisionLibTrackerConfig\",\n" +
+            "  \"version\": 1,\n" +
+            "  \"meta\": {\n" +
+            "    \"name\": \"Synthetic sequence\",\n" +
+            "    \"description\": \"Generated by VLSyntheticSequenceGenerator\"\n" +
+            "  },\n" +
+            "  \"tracker\": {\n" +
+            "    \"type\": \"modelTracker\",\n" +
+            "    \"version\": 1,\n" +
+            "    \"parameters\": {\n" +
+            "      \"models\": [\n" + modelList +
+            "      ],\n" +
+            "      \"metric\": \"" + metric + "\",\n" +
+            "      \"intrinsicsDBURI\": \"" + GetJsonPath(calibrationPath) +
+                "\",\n" +
+            "      \"initPose\": {\n" +
+            "        \"type\": \"visionlib\",\n" +
+            "        \"t\": " + GetJsonArray(initPose.t) + ",\n" +
+            "        \"q\": " + GetJsonArray(initPose.q) + "\n" +
+            "      }\n" +
+            "    }\n" +
+            "  },\n" +
+            "  \"standIn\": {\"groundTruth\": \"" +
+                GetJsonPath(groundTruthPath) + "\"}\n" +
+            "}\n";
+
+        // Add the image sequence with the device ID of the calibration
+        return VLReplayRunner.AddImageSequenceInput(config,
+            GetJsonPath(imageSequenceURI), deviceID);
+    }
+
+    private static string GetJsonPath(string path)
+    {
+        return path.Replace('\\', '/');
+    }
+
+    private static string GetJsonArray(float[] values)
+    {
+        string[] strings = new string[values.Length];
+        for (int i = 0; i < values.Length; ++i)
+        {
+            strings[i] = values[i].ToString("R", CultureInfo.InvariantCulture);
+        }
+        return "[" + String.Join(", ", strings) + "]";
+    }
+
+    private static void WritePpm(string path, byte[] image, int width,
+        int height)
+    {
+        using (FileStream stream = new FileStream(path, FileMode.Create))
+        {
+            byte[] header = System.Text.Encoding.ASCII.GetBytes(
+                "P6\n" + width + " " + height + "\n255\n");
+            stream.Write(header, 0, header.Length);
+            stream.Write(image, 0, width * height * 3);
+        }
+    }
+
+    private static double GetDouble(string name, double defaultValue)
+    {
+        string value = VLReplayBenchmark.GetArgument(name, "");
+        return value.Length > 0 ?
+            Double.Parse(value, CultureInfo.InvariantCulture) : defaultValue;
+    }
+
+    /// <summary>
+    ///  Computes the pose of a camera on a circle around the target, which
+    ///  looks at the target. The y axis of the models points upwards.
+    /// </summary>
+    private static void GetOrbitPose(float[] target, double distance,
+        double elevation, double azimuth, double[] rotation,
+        double[] translation)
+    {
+        double el = elevation * Math.PI / 180.0;
+        double az = azimuth * Math.PI / 180.0;
+        double[] position = new double[]
+        {
+            target[0] + distance * Math.Cos(el) * Math.Sin(az),
+            target[1] + distance * Math.Sin(el),
+            target[2] + distance * Math.Cos(el) * Math.Cos(az)
+        };
+
+        // Rows of the rotation are the camera axes in model coordinates
+        // (x right, y down, z forward)
+        double[] z = Normalize(new double[]
+        {
+            target[0] - position[0],
+            target[1] - position[1],
+            target[2] - position[2]
+        });
+        double[] x = Normalize(Cross(z, new double[] { 0.0, 1.0, 0.0 }));
+        double[] y = Cross(z, x);
+        for (int i = 0; i < 3; ++i)
+        {
+            rotation[i] = x[i];
+            rotation[3 + i] = y[i];
+            rotation[6 + i] = z[i];
+        }
+        for (int i = 0; i < 3; ++i)
+        {
+            translation[i] = -(rotation[3 * i] * position[0] +
+                rotation[3 * i + 1] * position[1] +
+                rotation[3 * i + 2] * position[2]);
+        }
+    }
+
+    private static double[] Cross(double[] a, double[] b)
+    {
+        return new double[]
+        {
+            a[1] * b[2] - a[2] * b[1],
+            a[2] * b[0] - a[0] * b[2],
+            a[0] * b[1] - a[1] * b[0]
+        };
+    }
+
+    private static double[] Normalize(double[] v)
+    {
+        double length = Math.Sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        return new double[] { v[0] / length, v[1] / length, v[2] / length };
+    }
+
+    /// <summary>
+    ///  Converts a row-major rotation matrix into a quaternion (x, y, z, w).
+    /// </summary>
+    private static float[] GetQuaternion(double[] m)
+    {
+        double x, y, z, w;
+        double trace = m[0] + m[4] + m[8];
+        if (trace > 0.0)
+        {
+            double s = 0.5 / Math.Sqrt(trace + 1.0);
+            w = 0.25 / s;
+            x = (m[7] - m[5]) * s;
+            y = (m[2] - m[6]) * s;
+            z = (m[3] - m[1]) * s;
+        }
+        else if (m[0] > m[4] && m[0] > m[8])
+        {
+            double s = 2.0 * Math.Sqrt(1.0 + m[0] - m[4] - m[8]);
+            w = (m[7] - m[5]) / s;
+            x = 0.25 * s;
+            y = (m[1] + m[3]) / s;
+            z = (m[2] + m[6]) / s;
+        }
+        else if (m[4] > m[8])
+        {
+            double s = 2.0 * Math.Sqrt(1.0 + m[4] - m[0] - m[8]);
+            w = (m[2] - m[6]) / s;
+            x = (m[1] + m[3]) / s;
+            y = 0.25 * s;
+            z = (m[5] + m[7]) / s;
+        }
+        else
+        {
+            double s = 2.0 * Math.Sqrt(1.0 + m[8] - m[0] - m[4]);
+            w = (m[3] - m[1]) / s;
+            x = (m[2] + m[6]) / s;
+            y = (m[5] + m[7]) / s;
+            z = 0.25 * s;
+        }
+        return new float[] { (float)x, (float)y, (float)z, (float)w };
+    }
+
+    /// <summary>
+    ///  Converts a quaternion (x, y, z, w) into a row-major rotation matrix.
+    /// </summary>
+    private static void GetRotationMatrix(float[] q, double[] m)
+    {
+        double x = q[0];
+        double y = q[1];
+        double z = q[2];
+        double w = q[3];
+        m[0] = 1.0 - 2.0 * (y * y + z * z);
+        m[1] = 2.0 * (x * y - z * w);
+        m[2] = 2.0 * (x * z + y * w);
+        m[3] = 2.0 * (x * y + z * w);
+        m[4] = 1.0 - 2.0 * (x * x + z * z);
+        m[5] = 2.0 * (y * z - x * w);
+        m[6] = 2.0 * (x * z - y * w);
+        m[7] = 2.0 * (y * z + x * w);
+        m[8] = 1.0 - 2.0 * (x * x + y * y);
+    }
+}
@@ -0,0 +1,442 @@
+using AOT;
+using UnityEngine;
+using UnityEditor;
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using VLWorkerCommands;
+
+/// <summary>
+///  Measures the call overhead and the managed allocations of the wrapper
+///  functions, which are called for every frame.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The benchmark can be started from the menu or in batch mode using
+///   <c>-batchmode -quit -executeMethod VLWrapperBenchmark.Run</c>.
+///   It replays an image sequence like <see cref="VLReplayBenchmark"/> and
+///   supports the same command line arguments. Additionally the key for
+///   the DataSet lookup can be specified using <c>-imageKey &lt;key&gt;</c>.
+///  </para>
+///  <para>
+///   The results are written as JSON. The allocated bytes are counted by
+///   the runtime for the calling thread. Allocations of other threads, e.g.
+///   of the tracking thread, aren't included.
+///  </para>
+/// </remarks>
+public static class VLWrapperBenchmark
+{
+    /// <summary>
+    ///  Result of a single benchmark.
+    /// </summary>
+    [Serializable]
+    public class Measurement
+    {
+        /// <summary>
+        ///  Name of the measured wrapper function and of the variant.
+        /// </summary>
+        public string name;
+
+        /// <summary>Number of timed calls.</summary>
+        public long iterations;
+
+        /// <summary>Mean wall clock time of one call in nanoseconds.</summary>
+        public double nanosecondsPerCall;
+
+        /// <summary>
+        ///  Mean number of bytes allocated on the managed heap by one call.
+        /// </summary>
+        public double allocatedBytesPerCall;
+    }
+
+    /// <summary>
+    ///  Results of all benchmarks.
+    /// </summary>
+    [Serializable]
+    public class Report
+    {
+        /// <summary>Version string of the VisionLib.</summary>
+        public string version;
+
+        /// <summary>Results in the order of the benchmarks.</summary>
+        public List<Measurement> measurements = new List<Measurement>();
+    }
+
+    private const int warmupIterations = 10;
+    private const int allocationIterations = 1000;
+    private const double minSeconds = 0.1;
+    private const int maxFrames = 100;
+    private const int commandBatchSize = 256;
+    private const double maxDrainSeconds = 10.0;
+    private static readonly int[] listenerCounts = new int[] { 0, 1, 4, 16 };
+
+    private static Report report;
+    private static bool imageMeasured;
+    private static bool extrinsicDataMeasured;
+    private static bool intrinsicDataMeasured;
+    private static long commandCallbacks;
+
+    [MenuItem("VisionLib/Benchmarks/Wrapper Calls")]
+    public static void Run()
+    {
+        string config = VLReplayBenchmark.GetArgument("-vlConfig",
+            "Examples/ModelTracking/MutableModelTracking/Pieces.vl");
+        string imageSequence = VLReplayBenchmark.GetArgument("-imageSequence",
+            "local_storage_dir:records/record/image_*.jpg");
+        string license =
+            VLReplayBenchmark.GetArgument("-license", "license.xml");
+        string imageKey = VLReplayBenchmark.GetArgument("-imageKey", "imgRGB");
+        string output = VLReplayBenchmark.GetArgument("-output", "");
+
+        string configPath = Path.Combine(
+            Path.Combine(Application.streamingAssetsPath, "VisionLib"),
+            config);
+        string licensePath =
+            Path.Combine(Application.streamingAssetsPath, license);
+        string pluginPath = Application.dataPath +
+            Path.DirectorySeparatorChar + "Plugins" +
+            Path.DirectorySeparatorChar + VLUnitySdk.subDir;
+
+        report = new Report();
+        VLUnitySdk.GetVersionString(out report.version);
+        imageMeasured = false;
+        extrinsicDataMeasured = false;
+        intrinsicDataMeasured = false;
+
+        using (VLReplayRunner runner =
+            new VLReplayRunner(licensePath, pluginPath))
+        {
+            if (!runner.CreateTracker(configPath,
+                (imageSequence.Length > 0 ? imageSequence : null)))
+            {
+                UnityEngine.Debug.LogError(
+                    "[vlUnitySDK] Failed to start the replay of '" +
+                    configPath + "'");
+                if (Application.isBatchMode)
+                {
+                    EditorApplication.Exit(1);
+                }
+                return;
+            }
+
+            MeasureListeners(runner.GetWorker());
+            MeasurePollEvents(runner.GetWorker());
+            MeasurePushJsonCommand(runner.GetWorker());
+            MeasureGetImage(runner.GetApplication(), imageKey);
+        }
+
+        string json = JsonUtility.ToJson(report, true);
+        if (output.Length > 0)
+        {
+            File.WriteAllText(output, json);
+        }
+        UnityEngine.Debug.Log("[vlUnitySDK] Wrapper call overhead\n" + json);
+    }
+
+    [MonoPInvokeCallback(typeof(VLWorker.ImageWrapperCallback))]
+    private static void DispatchImageCallback(IntPtr handle, IntPtr clientData)
+    {
+        try
+        {
+            if (imageMeasured)
+            {
+                return;
+            }
+            imageMeasured = true;
+
+            VLImageWrapper image = new VLImageWrapper(handle, false);
+            byte[] buffer = new byte[
+                image.GetWidth() * image.GetHeight() * image.GetBytesPerPixel()];
+            Measure("vlImageWrapper_CopyToBuffer",
+                () => image.CopyToBuffer(buffer));
+            image.Dispose();
+        }
+        catch (Exception e) // Catch all exceptions, because this is a callback
+                            // invoked from native code
+        {
+            UnityEngine.Debug.LogError("[vlUnitySDK] " + e.GetType().Name +
+                ": " + e.Message);
+        }
+    }
+    private static VLWorker.ImageWrapperCallback dispatchImageCallbackDelegate =
+        new VLWorker.ImageWrapperCallback(DispatchImageCallback);
+
+    [MonoPInvokeCallback(typeof(VLWorker.ExtrinsicDataWrapperCallback))]
+    private static void DispatchExtrinsicDataCallback(IntPtr handle,
+        IntPtr clientData)
+    {
+        try
+        {
+            if (extrinsicDataMeasured)
+            {
+                return;
+            }
+            extrinsicDataMeasured = true;
+
+            VLExtrinsicDataWrapper extrinsicData =
+                new VLExtrinsicDataWrapper(handle, false);
+            float[] matrix = new float[16];
+            Measure("vlExtrinsicDataWrapper_GetModelViewMatrix",
+                () => extrinsicData.GetModelViewMatrix(matrix));
+            extrinsicData.Dispose();
+        }
+        catch (Exception e) // Catch all exceptions, because this is a callback
+                            // invoked from native code
+        {
+            UnityEngine.Debug.LogError("[vlUnitySDK] " + e.GetType().Name +
+                ": " + e.Message);
+        }
+    }
+    private static VLWorker.ExtrinsicDataWrapperCallback dispatchExtrinsicDataCallbackDelegate =
+        new VLWorker.ExtrinsicDataWrapperCallback(DispatchExtrinsicDataCallback);
+
+    [MonoPInvokeCallback(typeof(VLWorker.IntrinsicDataWrapperCallback))]
+    private static void DispatchIntrinsicDataCallback(IntPtr handle,
+        IntPtr clientData)
+    {
+        try
+        {
+            if (intrinsicDataMeasured)
+            {
+                return;
+            }
+            intrinsicDataMeasured = true;
+
+            VLIntrinsicDataWrapper intrinsicData =
+                new VLIntrinsicDataWrapper(handle, false);
+            float[] matrix = new float[16];
+            Measure("vlIntrinsicDataWrapper_GetProjectionMatrix",
+                () => intrinsicData.GetProjectionMatrix(0.01f, 10.0f, 1920,
+                    1080, VLRenderRotation.CCW0, 0, matrix));
+            intrinsicData.Dispose();
+        }
+        catch (Exception e) // Catch all exceptions, because this is a callback
+                            // invoked from native code
+        {
+            UnityEngine.Debug.LogError("[vlUnitySDK] " + e.GetType().Name +
+                ": " + e.Message);
+        }
+    }
+    private static VLWorker.IntrinsicDataWrapperCallback dispatchIntrinsicDataCallbackDelegate =
+        new VLWorker.IntrinsicDataWrapperCallback(DispatchIntrinsicDataCallback);
+
+    [MonoPInvokeCallback(typeof(VLWorker.StringCallback))]
+    private static void DispatchTrackingStateCallback(string trackingStateJson,
+        IntPtr clientData)
+    {
+    }
+    private static VLWorker.StringCallback dispatchTrackingStateCallbackDelegate =
+        new VLWorker.StringCallback(DispatchTrackingStateCallback);
+
+    [MonoPInvokeCallback(typeof(VLWorker.JsonStringCallback))]
+    private static void DispatchCommandCallback(string errorJson,
+        string resultJson, IntPtr clientData)
+    {
+        ++commandCallbacks;
+    }
+    private static VLWorker.JsonStringCallback dispatchCommandCallbackDelegate =
+        new VLWorker.JsonStringCallback(DispatchCommandCallback);
+
+    private static void MeasureListeners(VLWorker worker)
+    {
+        // The data is only valid inside the listeners, therefore the
+        // measurements happen there
+        worker.AddImageListener(dispatchImageCallbackDelegate, IntPtr.Zero);
+        worker.AddExtrinsicDataListener(
+            dispatchExtrinsicDataCallbackDelegate, IntPtr.Zero);
+        worker.AddIntrinsicDataListener(
+            dispatchIntrinsicDataCallbackDelegate, IntPtr.Zero);
+
+        for (int i = 0; i < maxFrames &&
+            !(imageMeasured && extrinsicDataMeasured && intrinsicDataMeasured);
+            ++i)
+        {
+            worker.RunOnceSync();
+            worker.ProcessCallbacks();
+            worker.PollEvents();
+        }
+
+        worker.RemoveIntrinsicDataListener(
+            dispatchIntrinsicDataCallbackDelegate, IntPtr.Zero);
+        worker.RemoveExtrinsicDataListener(
+            dispatchExtrinsicDataCallbackDelegate, IntPtr.Zero);
+        worker.RemoveImageListener(dispatchImageCallbackDelegate, IntPtr.Zero);
+    }
+
+    private static void MeasurePollEvents(VLWorker worker)
+    {
+        foreach (int listenerCount in listenerCounts)
+        {
+            // The client data distinguishes the listeners
+            for (int i = 0; i < listenerCount; ++i)
+            {
+                worker.AddTrackingStateListener(
+                    dispatchTrackingStateCallbackDelegate, new IntPtr(i + 1));
+            }
+
+            long ticks = 0;
+            CollectGarbage();
+            long bytes = GetAllocatedBytes();
+            for (int i = 0; i < maxFrames; ++i)
+            {
+                worker.RunOnceSync();
+                worker.ProcessCallbacks();
+                long startTicks = Stopwatch.GetTimestamp();
+                worker.PollEvents();
+                ticks += Stopwatch.GetTimestamp() - startTicks;
+            }
+            bytes = GetAllocatedBytes() - bytes;
+
+            AddMeasurement("vlWorker_PollEvents/listeners:" + listenerCount,
+                maxFrames, ticks, bytes);
+
+            for (int i = 0; i < listenerCount; ++i)
+            {
+                worker.RemoveTrackingStateListener(
+                    dispatchTrackingStateCallbackDelegate, new IntPtr(i + 1));
+            }
+        }
+    }
+
+    private static void MeasurePushJsonCommand(VLWorker worker)
+    {
+        string command = VLJsonUtility.ToJson(new GetAttributeCmd("metric"));
+
+        long iterations = 0;
+        long ticks = 0;
+        long bytes = 0;
+        commandCallbacks = 0;
+        CollectGarbage();
+        while (ticks < minSeconds * Stopwatch.Frequency)
+        {
+            long startBytes = GetAllocatedBytes();
+            long startTicks = Stopwatch.GetTimestamp();
+            for (int i = 0; i < commandBatchSize; ++i)
+            {
+                worker.PushJsonCommand(command,
+                    dispatchCommandCallbackDelegate, IntPtr.Zero);
+            }
+            ticks += Stopwatch.GetTimestamp() - startTicks;
+            bytes += GetAllocatedBytes() - startBytes;
+            iterations += commandBatchSize;
+
+            // Process the commands outside of the measurement. The next
+            // batch must not be queued behind the current one.
+            if (!DrainCommands(worker, iterations))
+            {
+                UnityEngine.Debug.LogWarning("[vlUnitySDK] Only " +
+                    commandCallbacks + " of " + iterations +
+                    " commands were processed");
+                break;
+            }
+        }
+
+        AddMeasurement("vlWorker_PushJsonCommand", iterations, ticks, bytes);
+    }
+
+    private static bool DrainCommands(VLWorker worker, long commandCount)
+    {
+        Stopwatch stopwatch = Stopwatch.StartNew();
+        while (commandCallbacks < commandCount)
+        {
+            if (stopwatch.Elapsed.TotalSeconds > maxDrainSeconds)
+            {
+                return false;
+            }
+            worker.RunOnceSync();
+            worker.ProcessCallbacks();
+        }
+        return true;
+    }
+
+    private static void MeasureGetImage(VLAbstractApplicationWrapper aap,
+        string imageKey)
+    {
+        using (VLDataSetWrapper dataSet = aap.GetDataSet())
+        {
+            if (dataSet == null)
+            {
+                UnityEngine.Debug.LogWarning("[vlUnitySDK] Failed to get DataSet");
+                return;
+            }
+
+            Measure("vlDataSetWrapper_GetImage/" + imageKey, () =>
+            {
+                VLImageWrapper image = dataSet.GetImage(imageKey);
+                if (image != null)
+                {
+                    image.Dispose();
+                }
+            });
+            Measure("vlDataSetWrapper_GetImage/missing", () =>
+                dataSet.GetImage("vlWrapperBenchmarkMissingKey"));
+        }
+    }
+
+    private static void Measure(string name, Action call)
+    {
+        for (int i = 0; i < warmupIterations; ++i)
+        {
+            call();
+        }
+
+        CollectGarbage();
+        long bytes = GetAllocatedBytes();
+        for (int i = 0; i < allocationIterations; ++i)
+        {
+            call();
+        }
+        bytes = GetAllocatedBytes() - bytes;
+
+        // Repeat until the measurement is long enough to be stable
+        long iterations = 0;
+        Stopwatch stopwatch = Stopwatch.StartNew();
+        while (stopwatch.Elapsed.TotalSeconds < minSeconds)
+        {
+            for (int i = 0; i < allocationIterations; ++i)
+            {
+                call();
+            }
+            iterations += allocationIterations;
+        }
+        stopwatch.Stop();
+
+        Measurement measurement = new Measurement();
+        measurement.name = name;
+        measurement.iterations = iterations;
+        measurement.nanosecondsPerCall =
+            stopwatch.Elapsed.TotalMilliseconds * 1.0e6 / iterations;
+        measurement.allocatedBytesPerCall =
+            (double)bytes / allocationIterations;
+        report.measurements.Add(measurement);
+    }
+
+    private static void AddMeasurement(string name, long iterations,
+        long ticks, long bytes)
+    {
+        Measurement measurement = new Measurement();
+        measurement.name = name;
+        measurement.iterations = iterations;
+        measurement.nanosecondsPerCall =
+            ticks * 1.0e9 / Stopwatch.Frequency / iterations;
+        measurement.allocatedBytesPerCall = (double)bytes / iterations;
+        report.measurements.Add(measurement);
+    }
+
+    private static long GetAllocatedBytes()
+    {
+        // Unlike the size of the heap, this isn't reduced by collections
+        // during the measurement
+        return GC.GetAllocatedBytesForCurrentThread();
+    }
+
+    private static void CollectGarbage()
+    {
+        // Don't let garbage of the previous benchmark trigger a collection
+        // during the measurement
+        GC.Collect();
+        GC.WaitForPendingFinalizers();
+        GC.Collect();
+    }
+}
@@ -504,7 +504,10 @@ public class VLAbstractApplicationWrapper: IDisposable
             throw new ObjectDisposedException("VLAbstractApplicationWrapper");
         }
 
-        return vlAbstractApplicationWrapper_ApplyActions(this.handle);
+        using (VLTrace.BeginSpan("vlAbstractApplicationWrapper_ApplyActions"))
+        {
+            return vlAbstractApplicationWrapper_ApplyActions(this.handle);
+        }
     }
 
     [DllImport (VLUnitySdk.dllName)]
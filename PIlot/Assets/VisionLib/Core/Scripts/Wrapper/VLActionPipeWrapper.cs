@@ -335,7 +335,10 @@ public class VLActionPipeWrapper: IDisposable
             throw new ObjectDisposedException("VLActionPipeWrapper");
         }
 
-        return vlActionPipeWrapper_Apply(this.handle, dataSet.GetHandle());
+        using (VLTrace.BeginSpan("vlActionPipeWrapper_Apply"))
+        {
+            return vlActionPipeWrapper_Apply(this.handle, dataSet.GetHandle());
+        }
     }
 }
  /**@}*/
@@ -237,7 +237,10 @@ public class VLActionWrapper: IDisposable
             throw new ObjectDisposedException("VLActionWrapper");
         }
 
-        return vlActionWrapper_Apply(this.handle, dataSet.GetHandle());
+        using (VLTrace.BeginSpan("vlActionWrapper_Apply"))
+        {
+            return vlActionWrapper_Apply(this.handle, dataSet.GetHandle());
+        }
     }
 }
 
@@ -18,6 +18,14 @@ public class VLExtrinsicDataWrapper: IDisposable
     private IntPtr handle;
     private bool disposed = false;
     private bool owner;
+    private long frameIndex = -1;
+    private double frameTimestamp = 0.0;
+    private bool detached = false;
+    private bool detachedValid;
+    private float[] detachedModelViewMatrix;
+    private float[] detachedT;
+    private float[] detachedR;
+    private float[] detachedCamPosWorld;
 
     /// <summary>
     ///  Constructor of VLExtrinsicDataWrapper.
@@ -91,6 +99,87 @@ public class VLExtrinsicDataWrapper: IDisposable
         GC.SuppressFinalize(this);
     }
 
+    /// <summary>
+    ///  Returns the index of the frame this extrinsic data belongs to.
+    /// </summary>
+    /// <returns>
+    ///  Frame index or -1, if the extrinsic data wasn't received from a worker.
+    /// </returns>
+    /// <seealso cref="VLFrameClock"/>
+    public long GetFrameIndex()
+    {
+        return this.frameIndex;
+    }
+
+    /// <summary>
+    ///  Returns the monotonic timestamp in seconds of the frame this
+    ///  extrinsic data belongs to.
+    /// </summary>
+    /// <seealso cref="VLFrameClock.GetTime"/>
+    public double GetFrameTimestamp()
+    {
+        return this.frameTimestamp;
+    }
+
+    /// <summary>
+    ///  Assigns the extrinsic data to a frame.
+    /// </summary>
+    /// <param name="frameIndex">Index of the frame.</param>
+    /// <param name="frameTimestamp">Timestamp of the frame in seconds.</param>
+    public void SetFrame(long frameIndex, double frameTimestamp)
+    {
+        this.frameIndex = frameIndex;
+        this.frameTimestamp = frameTimestamp;
+    }
+
+    /// <summary>
+    ///  Creates a copy of the extrinsic data, which doesn't depend on the
+    ///  native object.
+    /// </summary>
+    /// <remarks>
+    ///  Extrinsic data received by a listener is only valid during the
+    ///  callback. The snapshot stays valid afterwards and can be used from
+    ///  any thread. It is read-only, all setters will return <c>false</c>.
+    /// </remarks>
+    /// <returns>
+    ///  New VLExtrinsicDataWrapper with the current values.
+    /// </returns>
+    public VLExtrinsicDataWrapper CreateSnapshot()
+    {
+        if (this.disposed)
+        {
+            throw new ObjectDisposedException("VLExtrinsicDataWrapper");
+        }
+
+        VLExtrinsicDataWrapper snapshot =
+            new VLExtrinsicDataWrapper(IntPtr.Zero, false);
+        snapshot.frameIndex = this.frameIndex;
+        snapshot.frameTimestamp = this.frameTimestamp;
+        snapshot.detachedValid = GetValid();
+        snapshot.detachedModelViewMatrix = new float[16];
+        snapshot.detachedT = new float[3];
+        snapshot.detachedR = new float[4];
+        snapshot.detachedCamPosWorld = new float[3];
+        GetModelViewMatrix(snapshot.detachedModelViewMatrix);
+        GetT(snapshot.detachedT);
+        GetR(snapshot.detachedR);
+        GetCamPosWorld(snapshot.detachedCamPosWorld);
+        snapshot.detached = true;
+
+        return snapshot;
+    }
+
+    private static bool CopyDetached(float[] src, float[] dst)
+    {
+        if (dst.Length < src.Length)
+        {
+            return false;
+        }
+
+        Array.Copy(src, dst, src.Length);
+        return true;
+    }
+
     [DllImport (VLUnitySdk.dllName)]
     private static extern bool vlExtrinsicDataWrapper_GetValid(
         IntPtr extrinsicDataWrapper);
@@ -109,6 +198,11 @@ public class VLExtrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLExtrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedValid;
+        }
+
         return vlExtrinsicDataWrapper_GetValid(this.handle);
     }
 
@@ -144,6 +238,11 @@ public class VLExtrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLExtrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return CopyDetached(this.detachedModelViewMatrix, matrix);
+        }
+
         bool result = false;
         GCHandle matrixHandle = GCHandle.Alloc(matrix, GCHandleType.Pinned);
         try
@@ -188,6 +287,11 @@ public class VLExtrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLExtrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return CopyDetached(this.detachedT, t);
+        }
+
         bool result = false;
         GCHandle vectorHandle = GCHandle.Alloc(t, GCHandleType.Pinned);
         try
@@ -233,6 +337,12 @@ public class VLExtrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLExtrinsicDataWrapper");
         }
 
+        // Snapshots are read-only
+        if (this.detached)
+        {
+            return false;
+        }
+
         bool result = false;
         GCHandle vectorHandle = GCHandle.Alloc(t, GCHandleType.Pinned);
         try
@@ -278,6 +388,11 @@ public class VLExtrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLExtrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return CopyDetached(this.detachedR, q);
+        }
+
         bool result = false;
         GCHandle quaternionHandle = GCHandle.Alloc(q, GCHandleType.Pinned);
         try
@@ -323,6 +438,12 @@ public class VLExtrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLExtrinsicDataWrapper");
         }
 
+        // Snapshots are read-only
+        if (this.detached)
+        {
+            return false;
+        }
+
         bool result = false;
         GCHandle quaternionHandle = GCHandle.Alloc(q, GCHandleType.Pinned);
         try
@@ -366,6 +487,11 @@ public class VLExtrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLExtrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return CopyDetached(this.detachedCamPosWorld, pos);
+        }
+
         bool result = false;
         GCHandle vectorHandle = GCHandle.Alloc(pos, GCHandleType.Pinned);
         try
@@ -410,6 +536,12 @@ public class VLExtrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLExtrinsicDataWrapper");
         }
 
+        // Snapshots are read-only
+        if (this.detached)
+        {
+            return false;
+        }
+
         bool result = false;
         GCHandle vectorHandle = GCHandle.Alloc(pos, GCHandleType.Pinned);
         try
@@ -0,0 +1,46 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+
+/// <summary>
+///  Reusable storage for the pixel data of a <see cref="VLImageWrapper"/>.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The storage will only be reallocated, if the size of the image changes.
+///   Passing the same VLImageBuffer to the VLImageWrapper of every frame
+///   therefore avoids allocating a new byte array for each camera image.
+///  </para>
+/// </remarks>
+/// <seealso cref="VLImageWrapper.Lock"/>
+public class VLImageBuffer
+{
+    private byte[] data = new byte[0];
+
+    /// <summary>
+    ///  Returns the byte array with the pixel data.
+    /// </summary>
+    public byte[] GetData()
+    {
+        return this.data;
+    }
+
+    /// <summary>
+    ///  Makes sure, that the byte array has exactly the given size.
+    /// </summary>
+    /// <remarks>
+    ///  The content of the byte array is undefined after the size changed.
+    /// </remarks>
+    /// <param name="size">Number of bytes.</param>
+    public void Reserve(int size)
+    {
+        if (this.data.Length != size)
+        {
+            this.data = new byte[size];
+        }
+    }
+}
+
+/**@}*/
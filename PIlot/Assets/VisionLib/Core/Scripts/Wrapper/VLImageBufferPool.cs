@@ -0,0 +1,166 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using System;
+using System.Collections.Generic;
+using System.Threading;
+
+/// <summary>
+///  Thread-safe pool of <see cref="VLImageBuffer"/> objects.
+/// </summary>
+/// <remarks>
+///  <para>
+///   A VLImageWrapper created with a pool acquires its storage from the
+///   pool and returns it after it got released. As long as no listener
+///   retains an image, the same buffer will be used for every frame.
+///  </para>
+///  <para>
+///   Buffers, which are returned while the pool already holds
+///   <c>maxFreeBuffers</c> buffers, will be left to the garbage collector.
+///  </para>
+/// </remarks>
+/// <seealso cref="VLImageWrapper.Retain"/>
+public class VLImageBufferPool
+{
+    private Stack<VLImageBuffer> freeBuffers = new Stack<VLImageBuffer>();
+    private int maxFreeBuffers;
+    private int allocationCount = 0;
+    private long acquiredBytes = 0;
+
+    /// <summary>
+    ///  Constructor of VLImageBufferPool.
+    /// </summary>
+    public VLImageBufferPool()
+        : this(4)
+    {
+    }
+
+    /// <summary>
+    ///  Constructor of VLImageBufferPool.
+    /// </summary>
+    /// <param name="maxFreeBuffers">
+    ///  Maximum number of unused buffers kept by the pool.
+    /// </param>
+    public VLImageBufferPool(int maxFreeBuffers)
+    {
+        this.maxFreeBuffers = maxFreeBuffers;
+    }
+
+    /// <summary>
+    ///  Returns an unused buffer with the given size.
+    /// </summary>
+    /// <remarks>
+    ///  A new buffer will only be allocated, if the pool is empty.
+    /// </remarks>
+    /// <param name="size">Number of bytes.</param>
+    public VLImageBuffer Acquire(int size)
+    {
+        VLImageBuffer buffer = null;
+        lock (this.freeBuffers)
+        {
+            if (this.freeBuffers.Count > 0)
+            {
+                buffer = this.freeBuffers.Pop();
+            }
+        }
+
+        if (buffer == null)
+        {
+            buffer = new VLImageBuffer();
+            int allocations = Interlocked.Increment(ref this.allocationCount);
+            VLLogBuffer.Log(VLUnitySdk.LogLevel.Info,
+                "Allocated image buffer #{0} ({1} bytes)", allocations, size);
+        }
+
+        buffer.Reserve(size);
+        Interlocked.Add(ref this.acquiredBytes, buffer.GetData().Length);
+        return buffer;
+    }
+
+    /// <summary>
+    ///  Gives a buffer acquired with <see cref="Acquire"/> back to the pool.
+    /// </summary>
+    /// <param name="buffer">Buffer, which isn't used anymore.</param>
+    public void Return(VLImageBuffer buffer)
+    {
+        if (buffer == null)
+        {
+            return;
+        }
+
+        Interlocked.Add(ref this.acquiredBytes, -buffer.GetData().Length);
+        lock (this.freeBuffers)
+        {
+            if (this.freeBuffers.Count < this.maxFreeBuffers)
+            {
+                this.freeBuffers.Push(buffer);
+            }
+        }
+    }
+
+    /// <summary>
+    ///  Returns the number of buffers allocated by this pool so far.
+    /// </summary>
+    public int GetAllocationCount()
+    {
+        return this.allocationCount;
+    }
+
+    /// <summary>
+    ///  Returns the number of bytes of all buffers, which are acquired and
+    ///  not returned yet.
+    /// </summary>
+    public long GetAcquiredBytes()
+    {
+        return Interlocked.Read(ref this.acquiredBytes);
+    }
+
+    /// <summary>
+    ///  Returns the number of bytes of all unused buffers currently held by
+    ///  the pool.
+    /// </summary>
+    public long GetFreeBufferBytes()
+    {
+        lock (this.freeBuffers)
+        {
+            long bytes = 0;
+            foreach (VLImageBuffer buffer in this.freeBuffers)
+            {
+                bytes += buffer.GetData().Length;
+            }
+            return bytes;
+        }
+    }
+
+    /// <summary>
+    ///  Leaves all unused buffers to the garbage collector.
+    /// </summary>
+    /// <returns>Number of bytes released.</returns>
+    public long Trim()
+    {
+        lock (this.freeBuffers)
+        {
+            long bytes = 0;
+            foreach (VLImageBuffer buffer in this.freeBuffers)
+            {
+                bytes += buffer.GetData().Length;
+            }
+            this.freeBuffers.Clear();
+            return bytes;
+        }
+    }
+
+    /// <summary>
+    ///  Returns the number of unused buffers currently held by the pool.
+    /// </summary>
+    public int GetFreeBufferCount()
+    {
+        lock (this.freeBuffers)
+        {
+            return this.freeBuffers.Count;
+        }
+    }
+}
+
+/**@}*/
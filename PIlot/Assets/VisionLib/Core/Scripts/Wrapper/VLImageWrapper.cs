@@ -5,6 +5,7 @@
 using System;
 using System.Collections;
 using System.Runtime.InteropServices;
+using System.Threading;
 
 /// <summary>
 ///  The VLImageWrapper is a wrapper for an Image object.
@@ -15,6 +16,19 @@ public class VLImageWrapper: IDisposable
     private IntPtr handle;
     private bool disposed = false;
     private bool owner;
+    private long frameIndex = -1;
+    private double frameTimestamp = 0.0;
+    private VLImageBuffer buffer;
+    private VLImageBufferPool pool;
+    private bool bufferValid = false;
+    private int lockCount = 0;
+    private int refCount = 1;
+    private bool detached = false;
+    private VLImageBuffer conversionBuffer;
+    private VLUnitySdk.ImageFormat detachedFormat;
+    private int detachedBytesPerPixel;
+    private int detachedWidth;
+    private int detachedHeight;
 
     /// <summary>
     ///  Constructor of VLImageWrapper.
@@ -32,9 +46,58 @@ public class VLImageWrapper: IDisposable
     ///  <c>false</c>, otherwise.
     /// </param>
     public VLImageWrapper(IntPtr handle, bool owner)
+        : this(handle, owner, new VLImageBuffer())
+    {
+    }
+
+    /// <summary>
+    ///  Constructor of VLImageWrapper with an external buffer.
+    /// </summary>
+    /// <remarks>
+    ///  The buffer will be used as storage by <see cref="Lock"/>. Passing the
+    ///  same buffer for every received image avoids allocating new memory for
+    ///  each frame.
+    /// </remarks>
+    /// <param name="handle">
+    ///  Handle to the native object.
+    /// </param>
+    /// <param name="owner">
+    ///  <c>true</c>, if the VLImageWrapper is the owner of the native object;
+    ///  <c>false</c>, otherwise.
+    /// </param>
+    /// <param name="buffer">
+    ///  Storage for the image data.
+    /// </param>
+    public VLImageWrapper(IntPtr handle, bool owner, VLImageBuffer buffer)
+    {
+        this.handle = handle;
+        this.owner = owner;
+        this.buffer = buffer;
+    }
+
+    /// <summary>
+    ///  Constructor of VLImageWrapper with a buffer pool.
+    /// </summary>
+    /// <remarks>
+    ///  The storage used by <see cref="Lock"/> will be acquired from the pool
+    ///  and returned to it after the last reference to the image has been
+    ///  released.
+    /// </remarks>
+    /// <param name="handle">
+    ///  Handle to the native object.
+    /// </param>
+    /// <param name="owner">
+    ///  <c>true</c>, if the VLImageWrapper is the owner of the native object;
+    ///  <c>false</c>, otherwise.
+    /// </param>
+    /// <param name="pool">
+    ///  Pool providing the storage for the image data.
+    /// </param>
+    public VLImageWrapper(IntPtr handle, bool owner, VLImageBufferPool pool)
     {
         this.handle = handle;
         this.owner = owner;
+        this.pool = pool;
     }
 
     ~VLImageWrapper()
@@ -58,6 +121,11 @@ public class VLImageWrapper: IDisposable
         if (disposing)
         {
             // Dispose managed resources (those that implement IDisposable)
+            if (this.pool != null)
+            {
+                this.pool.Return(this.buffer);
+                this.buffer = null;
+            }
         }
 
         // Clean up unmanaged resources
@@ -66,6 +134,7 @@ public class VLImageWrapper: IDisposable
             vlDelete_ImageWrapper(this.handle);
         }
         this.handle = IntPtr.Zero;
+        this.bufferValid = false;
 
         this.disposed = true;
     }
@@ -79,11 +148,52 @@ public class VLImageWrapper: IDisposable
     ///  <see cref="Dispose"/>, you must release all references to the
     ///  <see cref="VLImageWrapper"/> so the garbage collector can reclaim the
     ///  memory that the <see cref="VLImageWrapper"/> was occupying.
+    ///
+    ///  Dispose removes a reference like <see cref="Release"/>. The image is
+    ///  only disposed, if no other references from <see cref="Retain"/>
+    ///  exist. Otherwise the buffer would be returned to the pool while it
+    ///  is still in use.
     /// </remarks>
     public void Dispose()
     {
-        Dispose(true); // Dispose was explicitly called by the user
-        GC.SuppressFinalize(this);
+        if (this.disposed)
+        {
+            return;
+        }
+        Release();
+    }
+
+    /// <summary>
+    ///  Returns the index of the frame this image belongs to.
+    /// </summary>
+    /// <returns>
+    ///  Frame index or -1, if the image wasn't received from a worker.
+    /// </returns>
+    /// <seealso cref="VLFrameClock"/>
+    public long GetFrameIndex()
+    {
+        return this.frameIndex;
+    }
+
+    /// <summary>
+    ///  Returns the monotonic timestamp in seconds of the frame this
+    ///  image belongs to.
+    /// </summary>
+    /// <seealso cref="VLFrameClock.GetTime"/>
+    public double GetFrameTimestamp()
+    {
+        return this.frameTimestamp;
+    }
+
+    /// <summary>
+    ///  Assigns the image to a frame.
+    /// </summary>
+    /// <param name="frameIndex">Index of the frame.</param>
+    /// <param name="frameTimestamp">Timestamp of the frame in seconds.</param>
+    public void SetFrame(long frameIndex, double frameTimestamp)
+    {
+        this.frameIndex = frameIndex;
+        this.frameTimestamp = frameTimestamp;
     }
 
     [DllImport (VLUnitySdk.dllName)]
@@ -103,6 +213,11 @@ public class VLImageWrapper: IDisposable
             throw new ObjectDisposedException("VLImageWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedFormat;
+        }
+
         return (VLUnitySdk.ImageFormat)vlImageWrapper_GetFormat(this.handle);
     }
 
@@ -122,6 +237,11 @@ public class VLImageWrapper: IDisposable
             throw new ObjectDisposedException("VLImageWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedBytesPerPixel;
+        }
+
         return Convert.ToInt32(vlImageWrapper_GetBytesPerPixel(this.handle));
     }
 
@@ -141,6 +261,11 @@ public class VLImageWrapper: IDisposable
             throw new ObjectDisposedException("VLImageWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedWidth;
+        }
+
         return Convert.ToInt32(vlImageWrapper_GetWidth(this.handle));
     }
 
@@ -160,6 +285,11 @@ public class VLImageWrapper: IDisposable
             throw new ObjectDisposedException("VLImageWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedHeight;
+        }
+
         return Convert.ToInt32(vlImageWrapper_GetHeight(this.handle));
     }
 
@@ -189,6 +319,22 @@ public class VLImageWrapper: IDisposable
             throw new ObjectDisposedException("VLImageWrapper");
         }
 
+        if (this.detached)
+        {
+            if (!this.bufferValid)
+            {
+                return false;
+            }
+
+            byte[] data = this.buffer.GetData();
+            if (buffer.Length < data.Length)
+            {
+                return false;
+            }
+            Buffer.BlockCopy(data, 0, buffer, 0, data.Length);
+            return true;
+        }
+
         bool result = false;
         GCHandle bufferHandle = GCHandle.Alloc(buffer, GCHandleType.Pinned);
         try
@@ -207,6 +353,246 @@ public class VLImageWrapper: IDisposable
         return result;
     }
 
+    /// <summary>
+    ///  Copies a rectangle of the VisionLib image into the given byte array.
+    /// </summary>
+    /// <remarks>
+    ///  <para>
+    ///   In contrast to <see cref="CopyToBuffer(byte[])"/>, the rows of the
+    ///   destination can be padded. This allows writing directly into
+    ///   staging memory with an arbitrary row pitch.
+    ///  </para>
+    ///  <para>
+    ///   With a downscale factor of 2 or 4, each destination pixel is the
+    ///   average of a 2x2 or 4x4 block of the rectangle. The destination
+    ///   then needs (width / factor) x (height / factor) pixels.
+    ///  </para>
+    ///  <para>
+    ///   The image data is accessed via <see cref="Lock"/>, therefore
+    ///   cropping several rectangles from the same image only copies the
+    ///   image out of the VisionLib once.
+    ///  </para>
+    /// </remarks>
+    /// <returns>
+    ///  <c>true</c>, if the data was copied to the byte array successfully;
+    ///  <c>false</c> otherwise.
+    /// </returns>
+    /// <param name="buffer">Byte array for storing the image data.</param>
+    /// <param name="offset">
+    ///  Index of the first byte of the first row in the byte array.
+    /// </param>
+    /// <param name="stride">
+    ///  Number of bytes between two consecutive rows in the byte array.
+    /// </param>
+    /// <param name="x">Left border of the rectangle in pixels.</param>
+    /// <param name="y">Top border of the rectangle in pixels.</param>
+    /// <param name="width">Width of the rectangle in pixels.</param>
+    /// <param name="height">Height of the rectangle in pixels.</param>
+    /// <param name="downscale">Downscale factor (1, 2 or 4).</param>
+    public bool CopyToBuffer(byte[] buffer, int offset, int stride, int x,
+        int y, int width, int height, int downscale)
+    {
+        if (this.disposed)
+        {
+            throw new ObjectDisposedException("VLImageWrapper");
+        }
+
+        byte[] data;
+        int dataStride;
+        if (!Lock(out data, out dataStride))
+        {
+            return false;
+        }
+
+        bool result = false;
+        try
+        {
+            result = VLImageConversion.CopyRect(
+                data, dataStride, GetWidth(), GetHeight(), GetBytesPerPixel(),
+                x, y, width, height, downscale, buffer, offset, stride);
+        }
+        finally
+        {
+            Unlock();
+        }
+
+        return result;
+    }
+
+    /// <summary>
+    ///  Provides read-only access to the image data without copying it into
+    ///  a buffer of the caller.
+    /// </summary>
+    /// <remarks>
+    ///  <para>
+    ///   The image data will only be copied from the VisionLib once, during
+    ///   the first call to Lock. All further calls return the same byte
+    ///   array. This allows multiple consumers of the same image (e.g. all
+    ///   listeners of <see cref="VLWorkerBehaviour.OnImage"/>) to share one
+    ///   copy of the image.
+    ///  </para>
+    ///  <para>
+    ///   The rows of the image are tightly packed and the byte array must not
+    ///   be modified. It stays valid until <see cref="Unlock"/> was called
+    ///   and at most until the VLImageWrapper gets disposed. For images
+    ///   received by a listener this is the end of the listener callback.
+    ///  </para>
+    /// </remarks>
+    /// <returns>
+    ///  <c>true</c>, if the image data is accessible;
+    ///  <c>false</c> otherwise.
+    /// </returns>
+    /// <param name="data">
+    ///  Byte array with width * height * bytesPerPixel bytes of image data.
+    /// </param>
+    /// <param name="stride">
+    ///  Number of bytes between the beginning of two consecutive rows.
+    /// </param>
+    public bool Lock(out byte[] data, out int stride)
+    {
+        if (this.disposed)
+        {
+            throw new ObjectDisposedException("VLImageWrapper");
+        }
+
+        data = null;
+        stride = 0;
+
+        if (!this.bufferValid && !FillBuffer())
+        {
+            return false;
+        }
+
+        Interlocked.Increment(ref this.lockCount);
+        data = this.buffer.GetData();
+        stride = GetWidth() * GetBytesPerPixel();
+
+        return true;
+    }
+
+    /// <summary>
+    ///  Releases the access acquired with <see cref="Lock"/>.
+    /// </summary>
+    public void Unlock()
+    {
+        if (Interlocked.Decrement(ref this.lockCount) < 0)
+        {
+            Interlocked.Increment(ref this.lockCount);
+            throw new InvalidOperationException(
+                "VLImageWrapper.Unlock called without matching Lock");
+        }
+    }
+
+    /// <summary>
+    ///  Adds a reference to the image.
+    /// </summary>
+    /// <remarks>
+    ///  <para>
+    ///   Images received by a listener are only valid during the callback.
+    ///   Calling Retain inside the callback detaches the VLImageWrapper from
+    ///   the native image by copying the image data into a buffer of the
+    ///   <see cref="VLImageBufferPool"/> (which only happens once per
+    ///   frame). Afterwards the image can be used from any thread until
+    ///   <see cref="Release"/> has been called for each call to Retain.
+    ///  </para>
+    ///  <para>
+    ///   A detached image is read-only. The listener dispatcher holds the
+    ///   initial reference and releases it after all listeners have been
+    ///   notified.
+    ///  </para>
+    /// </remarks>
+    /// <returns>
+    ///  The VLImageWrapper itself or <c>null</c>, if the image data couldn't
+    ///  be copied.
+    /// </returns>
+    public VLImageWrapper Retain()
+    {
+        if (this.disposed)
+        {
+            throw new ObjectDisposedException("VLImageWrapper");
+        }
+
+        if (!this.detached && !Detach())
+        {
+            UnityEngine.Debug.LogError(
+                "[vlUnitySDK] VLImageWrapper.Retain: Failed to copy the image");
+            return null;
+        }
+
+        Interlocked.Increment(ref this.refCount);
+
+        return this;
+    }
+
+    /// <summary>
+    ///  Removes a reference to the image.
+    /// </summary>
+    /// <remarks>
+    ///  The image will be disposed and its buffer will be returned to the
+    ///  pool, after the last reference has been released.
+    /// </remarks>
+    public void Release()
+    {
+        int count = Interlocked.Decrement(ref this.refCount);
+        if (count == 0)
+        {
+            Dispose(true);
+            GC.SuppressFinalize(this);
+        }
+        else if (count < 0)
+        {
+            throw new InvalidOperationException(
+                "VLImageWrapper.Release called without matching Retain");
+        }
+    }
+
+    /// <summary>
+    ///  Returns the number of references to the image.
+    /// </summary>
+    public int GetReferenceCount()
+    {
+        return this.refCount;
+    }
+
+    private bool FillBuffer()
+    {
+        int imageByteSize = GetWidth() * GetHeight() * GetBytesPerPixel();
+        if (imageByteSize <= 0 || this.detached)
+        {
+            return false;
+        }
+
+        if (this.buffer == null)
+        {
+            this.buffer = (this.pool != null ?
+                this.pool.Acquire(imageByteSize) : new VLImageBuffer());
+        }
+
+        this.buffer.Reserve(imageByteSize);
+        this.bufferValid = CopyToBuffer(this.buffer.GetData());
+
+        return this.bufferValid;
+    }
+
+    private bool Detach()
+    {
+        // Cache everything, which would otherwise be read from the native
+        // image
+        this.detachedFormat = GetFormat();
+        this.detachedBytesPerPixel = GetBytesPerPixel();
+        this.detachedWidth = GetWidth();
+        this.detachedHeight = GetHeight();
+
+        // The image stays attached, if the copy failed
+        if (!this.bufferValid && !FillBuffer())
+        {
+            return false;
+        }
+
+        this.detached = true;
+        return true;
+    }
+
     [DllImport (VLUnitySdk.dllName)]
     private static extern bool vlImageWrapper_CopyFromBuffer(
         IntPtr imageWrapper, IntPtr buffer, System.UInt32 width,
@@ -249,6 +635,13 @@ public class VLImageWrapper: IDisposable
             return false;
         }
 
+        // Don't change the image data while someone is reading it
+        if (this.lockCount > 0 || this.detached)
+        {
+            return false;
+        }
+        this.bufferValid = false;
+
         bool result = false;
         GCHandle bufferHandle = GCHandle.Alloc(buffer, GCHandleType.Pinned);
         try
@@ -267,6 +660,133 @@ public class VLImageWrapper: IDisposable
 
         return result;
     }
+
+    [DllImport (VLUnitySdk.dllName)]
+    private static extern bool vlImageWrapper_CopyFromBufferWithFormat(
+        IntPtr imageWrapper, IntPtr buffer, System.UInt32 width,
+        System.UInt32 height, System.UInt32 imageFormat);
+    /// <summary>
+    ///  Copies the given camera image into the VisionLib image.
+    /// </summary>
+    /// <remarks>
+    ///  <para>
+    ///   The VisionLib image will be resized according to the width and height
+    ///   parameter.
+    ///  </para>
+    ///  <para>
+    ///   For <see cref="VLUnitySdk.CameraImageFormat.NV12"/> and
+    ///   <see cref="VLUnitySdk.CameraImageFormat.I420"/> images only the
+    ///   luma plane will be passed to the VisionLib as grey value image.
+    ///   The Unity SDK doesn't copy or convert the plane before.
+    ///   <see cref="VLUnitySdk.CameraImageFormat.YUYV"/> images will be
+    ///   reduced to their luma values and
+    ///   <see cref="VLUnitySdk.CameraImageFormat.BGRA"/> images will be
+    ///   swizzled to RGBA. The intermediate buffer for these conversions will
+    ///   be reused by subsequent calls.
+    ///  </para>
+    ///  <para>
+    ///   The VisionLib converts every image internally into the RGBA format.
+    ///   Passing the luma plane only saves the conversion of the chroma
+    ///   planes on the Unity side. It doesn't avoid the native conversion.
+    ///  </para>
+    /// </remarks>
+    /// <returns>
+    ///  <c>true</c>, if the data was copied into the image successfully;
+    ///  <c>false</c> otherwise.
+    /// </returns>
+    /// <param name="buffer">Byte array with the image data.</param>
+    /// <param name="width">New width of the image.</param>
+    /// <param name="height">New height of the image.</param>
+    /// <param name="format">Format of the data in the byte array.</param>
+    public bool CopyFromBufferWithFormat(byte[] buffer, int width, int height,
+        VLUnitySdk.CameraImageFormat format)
+    {
+        if (this.disposed)
+        {
+            throw new ObjectDisposedException("VLImageWrapper");
+        }
+
+        if (this.handle == IntPtr.Zero)
+        {
+            return false;
+        }
+
+        int bufferSize = VLImageConversion.GetBufferSize(format, width, height);
+        if (bufferSize <= 0 || buffer.Length < bufferSize)
+        {
+            return false;
+        }
+
+        // Don't change the image data while someone is reading it
+        if (this.lockCount > 0 || this.detached)
+        {
+            return false;
+        }
+        this.bufferValid = false;
+
+        int pixelCount = width * height;
+        byte[] nativeBuffer = buffer;
+        VLUnitySdk.ImageFormat nativeFormat;
+        switch (format)
+        {
+            case VLUnitySdk.CameraImageFormat.Grey:
+            // The luma plane is stored at the beginning of the buffer
+            case VLUnitySdk.CameraImageFormat.NV12:
+            case VLUnitySdk.CameraImageFormat.I420:
+                nativeFormat = VLUnitySdk.ImageFormat.Grey;
+                break;
+            case VLUnitySdk.CameraImageFormat.RGB:
+                nativeFormat = VLUnitySdk.ImageFormat.RGB;
+                break;
+            case VLUnitySdk.CameraImageFormat.RGBA:
+                nativeFormat = VLUnitySdk.ImageFormat.RGBA;
+                break;
+            case VLUnitySdk.CameraImageFormat.BGRA:
+                nativeBuffer = GetConversionBuffer(pixelCount * 4);
+                VLImageConversion.SwizzleBGRAToRGBA(
+                    buffer, nativeBuffer, pixelCount);
+                nativeFormat = VLUnitySdk.ImageFormat.RGBA;
+                break;
+            case VLUnitySdk.CameraImageFormat.YUYV:
+                nativeBuffer = GetConversionBuffer(pixelCount);
+                VLImageConversion.ExtractLumaYUYV(
+                    buffer, nativeBuffer, pixelCount);
+                nativeFormat = VLUnitySdk.ImageFormat.Grey;
+                break;
+            default:
+                return false;
+        }
+
+        bool result = false;
+        GCHandle bufferHandle = GCHandle.Alloc(nativeBuffer, GCHandleType.Pinned);
+        try
+        {
+            result = vlImageWrapper_CopyFromBufferWithFormat(
+                this.handle,
+                bufferHandle.AddrOfPinnedObject(),
+                Convert.ToUInt32(width),
+                Convert.ToUInt32(height),
+                Convert.ToUInt32(nativeFormat)
+            );
+        }
+        finally
+        {
+            bufferHandle.Free();
+        }
+
+        return result;
+    }
+
+    private byte[] GetConversionBuffer(int size)
+    {
+        if (this.conversionBuffer == null)
+        {
+            this.conversionBuffer = new VLImageBuffer();
+        }
+
+        this.conversionBuffer.Reserve(size);
+        return this.conversionBuffer.GetData();
+    }
 }
 
 /**@}*/
\ No newline at end of file
@@ -32,6 +32,19 @@ public class VLIntrinsicDataWrapper: IDisposable
     private IntPtr handle;
     private bool disposed = false;
     private bool owner;
+    private long frameIndex = -1;
+    private double frameTimestamp = 0.0;
+    private bool detached = false;
+    private int detachedWidth;
+    private int detachedHeight;
+    private double detachedFxNorm;
+    private double detachedFyNorm;
+    private double detachedSkewNorm;
+    private double detachedCxNorm;
+    private double detachedCyNorm;
+    private bool detachedCalibrated;
+    private double detachedCalibrationError;
+    private double[] detachedRadialDistortion;
 
     /// <summary>
     ///  Constructor of VLIntrinsicDataWrapper.
@@ -105,6 +118,79 @@ public class VLIntrinsicDataWrapper: IDisposable
         GC.SuppressFinalize(this);
     }
 
+    /// <summary>
+    ///  Returns the index of the frame this intrinsic data belongs to.
+    /// </summary>
+    /// <returns>
+    ///  Frame index or -1, if the intrinsic data wasn't received from a worker.
+    /// </returns>
+    /// <seealso cref="VLFrameClock"/>
+    public long GetFrameIndex()
+    {
+        return this.frameIndex;
+    }
+
+    /// <summary>
+    ///  Returns the monotonic timestamp in seconds of the frame this
+    ///  intrinsic data belongs to.
+    /// </summary>
+    /// <seealso cref="VLFrameClock.GetTime"/>
+    public double GetFrameTimestamp()
+    {
+        return this.frameTimestamp;
+    }
+
+    /// <summary>
+    ///  Assigns the intrinsic data to a frame.
+    /// </summary>
+    /// <param name="frameIndex">Index of the frame.</param>
+    /// <param name="frameTimestamp">Timestamp of the frame in seconds.</param>
+    public void SetFrame(long frameIndex, double frameTimestamp)
+    {
+        this.frameIndex = frameIndex;
+        this.frameTimestamp = frameTimestamp;
+    }
+
+    /// <summary>
+    ///  Creates a copy of the intrinsic data, which doesn't depend on the
+    ///  native object.
+    /// </summary>
+    /// <remarks>
+    ///  Intrinsic data received by a listener is only valid during the
+    ///  callback. The snapshot stays valid afterwards and can be used from
+    ///  any thread. It is read-only and only provides the calibration
+    ///  parameters, GetProjectionMatrix will return <c>false</c>.
+    /// </remarks>
+    /// <returns>
+    ///  New VLIntrinsicDataWrapper with the current values.
+    /// </returns>
+    public VLIntrinsicDataWrapper CreateSnapshot()
+    {
+        if (this.disposed)
+        {
+            throw new ObjectDisposedException("VLIntrinsicDataWrapper");
+        }
+
+        VLIntrinsicDataWrapper snapshot =
+            new VLIntrinsicDataWrapper(IntPtr.Zero, false);
+        snapshot.frameIndex = this.frameIndex;
+        snapshot.frameTimestamp = this.frameTimestamp;
+        snapshot.detachedWidth = GetWidth();
+        snapshot.detachedHeight = GetHeight();
+        snapshot.detachedFxNorm = GetFxNorm();
+        snapshot.detachedFyNorm = GetFyNorm();
+        snapshot.detachedSkewNorm = GetSkewNorm();
+        snapshot.detachedCxNorm = GetCxNorm();
+        snapshot.detachedCyNorm = GetCyNorm();
+        snapshot.detachedCalibrated = GetCalibrated();
+        snapshot.detachedCalibrationError = GetCalibrationError();
+        snapshot.detachedRadialDistortion = new double[5];
+        GetRadialDistortion(snapshot.detachedRadialDistortion);
+        snapshot.detached = true;
+
+        return snapshot;
+    }
+
     [DllImport (VLUnitySdk.dllName)]
     private static extern System.UInt32 vlIntrinsicDataWrapper_GetWidth(
         IntPtr intrinsicDataWrapper);
@@ -121,6 +207,11 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedWidth;
+        }
+
         return Convert.ToInt32(vlIntrinsicDataWrapper_GetWidth(this.handle));
     }
 
@@ -140,6 +231,11 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedHeight;
+        }
+
         return Convert.ToInt32(vlIntrinsicDataWrapper_GetHeight(this.handle));
     }
 
@@ -164,6 +260,11 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedFxNorm;
+        }
+
         return vlIntrinsicDataWrapper_GetFxNorm(this.handle);
     }
 
@@ -188,6 +289,11 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedFyNorm;
+        }
+
         return vlIntrinsicDataWrapper_GetFyNorm(this.handle);
     }
 
@@ -211,6 +317,11 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedSkewNorm;
+        }
+
         return vlIntrinsicDataWrapper_GetSkewNorm(this.handle);
     }
 
@@ -234,6 +345,11 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedCxNorm;
+        }
+
         return vlIntrinsicDataWrapper_GetCxNorm(this.handle);
     }
 
@@ -257,6 +373,11 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedCyNorm;
+        }
+
         return vlIntrinsicDataWrapper_GetCyNorm(this.handle);
     }
 
@@ -280,6 +401,11 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedCalibrated;
+        }
+
         return vlIntrinsicDataWrapper_GetCalibrated(this.handle);
     }
 
@@ -303,6 +429,11 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            return this.detachedCalibrationError;
+        }
+
         return vlIntrinsicDataWrapper_GetCalibrationError(this.handle);
     }
 
@@ -325,6 +456,17 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        if (this.detached)
+        {
+            if (k.Length < this.detachedRadialDistortion.Length)
+            {
+                return false;
+            }
+            Array.Copy(this.detachedRadialDistortion, k,
+                this.detachedRadialDistortion.Length);
+            return true;
+        }
+
         bool result = false;
         GCHandle arrayHandle = GCHandle.Alloc(k, GCHandleType.Pinned);
         try
@@ -363,6 +505,12 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        // Snapshots are read-only
+        if (this.detached)
+        {
+            return false;
+        }
+
         bool result = false;
         GCHandle arrayHandle = GCHandle.Alloc(k, GCHandleType.Pinned);
         try
@@ -450,6 +598,12 @@ public class VLIntrinsicDataWrapper: IDisposable
             throw new ObjectDisposedException("VLIntrinsicDataWrapper");
         }
 
+        // The projection matrix is computed by the native object
+        if (this.detached)
+        {
+            return false;
+        }
+
         bool result = false;
         GCHandle matrixHandle = GCHandle.Alloc(matrix, GCHandleType.Pinned);
         try
@@ -102,6 +102,46 @@ public static class VLUnitySdk
         RGBA = 3
     };
 
+    /// <summary>
+    ///  Formats of images provided by external cameras.
+    /// </summary>
+    /// <remarks>
+    ///  <para>
+    ///   These formats are handled by the Unity SDK and are never passed to
+    ///   the native VisionLib, which only knows the
+    ///   <see cref="ImageFormat"/> values. The planar YUV formats hand their
+    ///   luma plane to the VisionLib as grey value image without a
+    ///   conversion on the Unity side. The VisionLib itself converts all
+    ///   images internally into the RGBA format.
+    ///  </para>
+    /// </remarks>
+    /// <seealso cref="VLImageWrapper.CopyFromBufferWithFormat"/>
+    public enum CameraImageFormat
+    {
+        /// <summary>Grey value image.</summary>
+        Grey = 1,
+        /// <summary>Image with a red, green and blue channel.</summary>
+        RGB = 2,
+        /// <summary>Image with a red, green, blue and alpha channel.</summary>
+        RGBA = 3,
+        /// <summary>Image with a blue, green, red and alpha channel.</summary>
+        BGRA = 4,
+        /// <summary>
+        ///  Luma plane followed by one plane with interleaved U and V values
+        ///  subsampled by two in both directions.
+        /// </summary>
+        NV12 = 5,
+        /// <summary>
+        ///  Luma plane followed by separate U and V planes subsampled by two
+        ///  in both directions.
+        /// </summary>
+        I420 = 6,
+        /// <summary>
+        ///  Packed Y0 U Y1 V values with horizontally subsampled chroma.
+        /// </summary>
+        YUYV = 7
+    };
+
     // NOTICE: Make sure, that no exceptions escape from delegates, which are
     // called from unmanaged code
     [UnmanagedFunctionPointer(CallingConvention.StdCall)]
@@ -2,10 +2,12 @@
  *  @{
  */
 
+using AOT;
 using System;
 using System.Collections;
 using System.Runtime.InteropServices;
 using System.Collections.Generic;
+using System.Threading;
 using UnityEngine;
 
 /// <summary>
@@ -51,15 +53,235 @@ public class VLWorker: IDisposable
     private bool disposed = false;
     private bool owner;
 
+    /// <summary>
+    ///  Callback and client data of a command, which was pushed, but not
+    ///  processed yet.
+    /// </summary>
+    private class PendingCommand
+    {
+        public VLWorker worker;
+        public Delegate callback;
+        public IntPtr clientData;
+    }
+
+    // Handles of all pending commands. Commands are passed to the native
+    // code with the dispatch callbacks below, which allows counting the
+    // commands until their callback was called.
+    private HashSet<IntPtr> pendingCommands = new HashSet<IntPtr>();
+    private long pushedCommandCount = 0;
+    private long processedCommandCount = 0;
+
+    private IntPtr AddPendingCommand(Delegate callback, IntPtr clientData)
+    {
+        PendingCommand command = new PendingCommand();
+        command.worker = this;
+        command.callback = callback;
+        command.clientData = clientData;
+        IntPtr commandHandle = GCHandle.ToIntPtr(GCHandle.Alloc(command));
+        lock (this.pendingCommands)
+        {
+            this.pendingCommands.Add(commandHandle);
+        }
+        return commandHandle;
+    }
+
+    private void RemovePendingCommand(IntPtr commandHandle)
+    {
+        lock (this.pendingCommands)
+        {
+            if (!this.pendingCommands.Remove(commandHandle))
+            {
+                return;
+            }
+        }
+        GCHandle.FromIntPtr(commandHandle).Free();
+    }
+
+    private bool OnCommandPushed(bool success, IntPtr commandHandle)
+    {
+        if (success)
+        {
+            Interlocked.Increment(ref this.pushedCommandCount);
+        }
+        else
+        {
+            RemovePendingCommand(commandHandle);
+        }
+        return success;
+    }
+
+    private static PendingCommand CompleteCommand(IntPtr commandHandle)
+    {
+        PendingCommand command =
+            (PendingCommand)GCHandle.FromIntPtr(commandHandle).Target;
+        command.worker.RemovePendingCommand(commandHandle);
+        Interlocked.Increment(ref command.worker.processedCommandCount);
+        return command;
+    }
+
+    [MonoPInvokeCallback(typeof(BoolCallback))]
+    private static void DispatchBoolCallback(bool data, IntPtr clientData)
+    {
+        try
+        {
+            PendingCommand command = CompleteCommand(clientData);
+            if (command.callback != null)
+            {
+                ((BoolCallback)command.callback)(data, command.clientData);
+            }
+        }
+        catch (Exception e) // Catch all exceptions, because this is a callback
+                            // invoked from native code
+        {
+            Debug.LogError("[vlUnitySDK] " + e.GetType().Name + ": " +
+                e.Message);
+        }
+    }
+    private static BoolCallback dispatchBoolCallbackDelegate =
+        new BoolCallback(DispatchBoolCallback);
+
+    [MonoPInvokeCallback(typeof(JsonStringCallback))]
+    private static void DispatchJsonStringCallback(string errorJson,
+        string dataJson, IntPtr clientData)
+    {
+        try
+        {
+            PendingCommand command = CompleteCommand(clientData);
+            if (command.callback != null)
+            {
+                ((JsonStringCallback)command.callback)(
+                    errorJson, dataJson, command.clientData);
+            }
+        }
+        catch (Exception e) // Catch all exceptions, because this is a callback
+                            // invoked from native code
+        {
+            Debug.LogError("[vlUnitySDK] " + e.GetType().Name + ": " +
+                e.Message);
+        }
+    }
+    private static JsonStringCallback dispatchJsonStringCallbackDelegate =
+        new JsonStringCallback(DispatchJsonStringCallback);
+
+    [MonoPInvokeCallback(typeof(JsonStringAndBinaryCallback))]
+    private static void DispatchJsonStringAndBinaryCallback(
+        string description, string data, System.UInt32 dataSize,
+        IntPtr clientData)
+    {
+        try
+        {
+            PendingCommand command = CompleteCommand(clientData);
+            if (command.callback != null)
+            {
+                ((JsonStringAndBinaryCallback)command.callback)(
+                    description, data, dataSize, command.clientData);
+            }
+        }
+        catch (Exception e) // Catch all exceptions, because this is a callback
+                            // invoked from native code
+        {
+            Debug.LogError("[vlUnitySDK] " + e.GetType().Name + ": " +
+                e.Message);
+        }
+    }
+    private static JsonStringAndBinaryCallback dispatchJsonStringAndBinaryCallbackDelegate =
+        new JsonStringAndBinaryCallback(DispatchJsonStringAndBinaryCallback);
+
+    /// <summary>
+    ///  Returns the number of commands enqueued successfully so far.
+    /// </summary>
+    public long GetPushedCommandCount()
+    {
+        return Interlocked.Read(ref this.pushedCommandCount);
+    }
+
+    /// <summary>
+    ///  Returns the number of commands, whose callback was called so far.
+    /// </summary>
+    public long GetProcessedCommandCount()
+    {
+        return Interlocked.Read(ref this.processedCommandCount);
+    }
+
+    /// <summary>
+    ///  Returns the number of commands, which were enqueued, but whose
+    ///  callback wasn't called yet.
+    /// </summary>
+    /// <remarks>
+    ///  This includes commands, which were already processed by the
+    ///  tracking thread, but whose callback is still waiting for
+    ///  <see cref="ProcessCallbacks"/>.
+    /// </remarks>
+    public int GetPendingCommandCount()
+    {
+        lock (this.pendingCommands)
+        {
+            return this.pendingCommands.Count;
+        }
+    }
+
     [DllImport (VLUnitySdk.dllName)]
     private static extern IntPtr vlNew_Worker(IntPtr aap);
     [DllImport (VLUnitySdk.dllName)]
     private static extern IntPtr vlNew_SyncWorker(IntPtr aap);
+    [DllImport (VLUnitySdk.dllName)]
+    private static extern IntPtr vlNew_WorkerWithOptions(IntPtr aap,
+        [MarshalAs(UnmanagedType.LPStr)] string optionsJson);
+    [DllImport (VLUnitySdk.dllName)]
+    private static extern IntPtr vlNew_SyncWorkerWithOptions(IntPtr aap,
+        [MarshalAs(UnmanagedType.LPStr)] string optionsJson);
     /// <summary>
     ///  Constructor of VLWorker.
     /// </summary>
     public VLWorker(VLAbstractApplicationWrapper aap, bool synchronous=false)
+        : this(aap, null, synchronous)
+    {
+    }
+
+    /// <summary>
+    ///  Constructor of VLWorker with concurrency options.
+    /// </summary>
+    /// <remarks>
+    ///  If the vlSDK doesn't support the options or rejects them, a worker
+    ///  without options will be created.
+    /// </remarks>
+    /// <param name="aap">AbstractApplication of the worker.</param>
+    /// <param name="options">
+    ///  Concurrency options or <c>null</c> for the default behaviour.
+    /// </param>
+    /// <param name="synchronous">
+    ///  Whether the tracking runs in <see cref="RunOnceSync"/> instead of a
+    ///  tracking thread.
+    /// </param>
+    public VLWorker(VLAbstractApplicationWrapper aap, VLWorkerOptions options,
+        bool synchronous=false)
     {
+        if (options != null && !options.IsDefault())
+        {
+            string optionsJson = VLJsonUtility.ToJson(options);
+            try
+            {
+                this.handle = !synchronous ?
+                    vlNew_WorkerWithOptions(aap.GetHandle(), optionsJson) :
+                    vlNew_SyncWorkerWithOptions(aap.GetHandle(), optionsJson);
+                if (this.handle == IntPtr.Zero)
+                {
+                    Debug.LogWarning("[vlUnitySDK] Invalid worker options: " +
+                        optionsJson);
+                }
+            }
+            catch (EntryPointNotFoundException)
+            {
+                // The VisionLib only supports the default behaviour
+                Debug.LogWarning("[vlUnitySDK] The vlSDK doesn't support worker options");
+            }
+            if (this.handle != IntPtr.Zero)
+            {
+                this.owner = true;
+                return;
+            }
+        }
+
         if (!synchronous)
         {
             this.handle = vlNew_Worker(aap.GetHandle());
@@ -105,6 +327,16 @@ public class VLWorker: IDisposable
         }
         this.handle = IntPtr.Zero;
 
+        // The callbacks of the remaining commands will never be called
+        lock (this.pendingCommands)
+        {
+            foreach (IntPtr commandHandle in this.pendingCommands)
+            {
+                GCHandle.FromIntPtr(commandHandle).Free();
+            }
+            this.pendingCommands.Clear();
+        }
+
         this.disposed = true;
     }
 
@@ -184,7 +416,10 @@ public class VLWorker: IDisposable
             throw new ObjectDisposedException("VLWorker");
         }
 
-        return vlWorker_RunOnceSync(this.handle);
+        using (VLTrace.BeginSpan("vlWorker_RunOnceSync"))
+        {
+            return vlWorker_RunOnceSync(this.handle);
+        }
     }
 
     [DllImport (VLUnitySdk.dllName)]
@@ -301,8 +536,13 @@ public class VLWorker: IDisposable
             throw new ObjectDisposedException("VLWorker");
         }
 
-        return vlWorker_PushCommand(
-            this.handle, name, parameter, callback, clientData);
+        using (VLTrace.BeginSpan("vlWorker_PushCommand", name))
+        {
+            IntPtr commandHandle = AddPendingCommand(callback, clientData);
+            return OnCommandPushed(vlWorker_PushCommand(this.handle, name,
+                parameter, dispatchBoolCallbackDelegate, commandHandle),
+                commandHandle);
+        }
     }
 
     [DllImport (VLUnitySdk.dllName)]
@@ -347,8 +587,13 @@ public class VLWorker: IDisposable
             throw new ObjectDisposedException("VLWorker");
         }
 
-        return vlWorker_PushJsonCommand(
-            this.handle, jsonString, callback, clientData);
+        using (VLTrace.BeginSpan("vlWorker_PushJsonCommand"))
+        {
+            IntPtr commandHandle = AddPendingCommand(callback, clientData);
+            return OnCommandPushed(vlWorker_PushJsonCommand(this.handle,
+                jsonString, dispatchJsonStringCallbackDelegate, commandHandle),
+                commandHandle);
+        }
     }
 
     /// <summary>
@@ -386,8 +631,13 @@ public class VLWorker: IDisposable
             throw new ObjectDisposedException("VLWorker");
         }
 
-        return vlWorker_PushJsonCommand(this.handle,
-            VLJsonUtility.ToJson(cmd), callback, clientData);
+        using (VLTrace.BeginSpan("vlWorker_PushJsonCommand", cmd.name))
+        {
+            IntPtr commandHandle = AddPendingCommand(callback, clientData);
+            return OnCommandPushed(vlWorker_PushJsonCommand(this.handle,
+                VLJsonUtility.ToJson(cmd), dispatchJsonStringCallbackDelegate,
+                commandHandle), commandHandle);
+        }
     }
 
     [DllImport (VLUnitySdk.dllName)]
@@ -412,7 +662,10 @@ public class VLWorker: IDisposable
             throw new ObjectDisposedException("VLWorker");
         }
 
-        return vlWorker_ProcessCallbacks(this.handle);
+        using (VLTrace.BeginSpan("vlWorker_ProcessCallbacks"))
+        {
+            return vlWorker_ProcessCallbacks(this.handle);
+        }
     }
 
     [DllImport (VLUnitySdk.dllName)]
@@ -966,7 +1219,10 @@ public class VLWorker: IDisposable
             throw new ObjectDisposedException("VLWorker");
         }
 
-        return vlWorker_PollEvents(this.handle);
+        using (VLTrace.BeginSpan("vlWorker_PollEvents"))
+        {
+            return vlWorker_PollEvents(this.handle);
+        }
     }
 
     [DllImport (VLUnitySdk.dllName)]
@@ -1002,7 +1258,10 @@ public class VLWorker: IDisposable
             throw new ObjectDisposedException("VLWorker");
         }
 
-        return vlWorker_WaitEvents(this.handle, timeout);
+        using (VLTrace.BeginSpan("vlWorker_WaitEvents"))
+        {
+            return vlWorker_WaitEvents(this.handle, timeout);
+        }
     }
 
     // [DllImport (VLUnitySdk.dllName)]
@@ -1086,13 +1345,17 @@ public class VLWorker: IDisposable
 
 
 
-        return vlWorker_PushJsonAndBinaryCommand(
-            this.handle, 
-            jsonString,
-            binaryDataPtr,
-            binaryDataSize,
-            callback,
-            clientData);
+        using (VLTrace.BeginSpan("vlWorker_PushJsonAndBinaryCommand"))
+        {
+            IntPtr commandHandle = AddPendingCommand(callback, clientData);
+            return OnCommandPushed(vlWorker_PushJsonAndBinaryCommand(
+                this.handle, 
+                jsonString,
+                binaryDataPtr,
+                binaryDataSize,
+                dispatchJsonStringAndBinaryCallbackDelegate,
+                commandHandle), commandHandle);
+        }
 
 
     }
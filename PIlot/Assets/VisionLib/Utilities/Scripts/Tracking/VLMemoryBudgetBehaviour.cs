@@ -0,0 +1,208 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using UnityEngine;
+using UnityEngine.Events;
+using System;
+
+/// <summary>
+///  Accounts the memory of the tracking subsystems and keeps it below a
+///  budget.
+/// </summary>
+/// <remarks>
+///  <para>
+///   The memory grows during long sessions, because the tracker learns
+///   new templates. The template memory is estimated from the tracking
+///   state with <see cref="estimatedBytesPerTemplate"/>. See
+///   <see cref="VLMemoryAccounting"/> for details.
+///  </para>
+///  <para>
+///   If the accounted memory exceeds the budget, the unused image buffers
+///   get released first. If this isn't sufficient, a hard reset discards
+///   all learned templates. The VisionLib doesn't allow removing
+///   single templates, so they can't be evicted selectively.
+///  </para>
+///  <para>
+///   The event and the release of the image buffers only happen, when the
+///   memory crosses the budget. They happen again after the memory fell
+///   below <see cref="releaseFraction"/> of the budget.
+///  </para>
+/// </remarks>
+[AddComponentMenu("VisionLib/VL Memory Budget Behaviour")]
+public class VLMemoryBudgetBehaviour : VLWorkerReferenceBehaviour
+{
+    [Serializable]
+    public class OnBudgetExceededEvent : UnityEvent<long>{}
+
+    /// <summary>
+    ///  Memory budget in megabytes. Zero disables the budget.
+    /// </summary>
+    [Tooltip("Memory budget in megabytes. Zero disables the budget.")]
+    public int budgetMegabytes = 0;
+
+    /// <summary>
+    ///  Estimated memory of one template in bytes.
+    /// </summary>
+    [Tooltip("Estimated memory of one template in bytes.")]
+    public int estimatedBytesPerTemplate = 64 * 1024;
+
+    /// <summary>
+    ///  Estimated memory of one line model in bytes.
+    /// </summary>
+    [Tooltip("Estimated memory of one line model in bytes.")]
+    public int estimatedBytesPerLineModel = 256 * 1024;
+
+    /// <summary>
+    ///  Minimum number of seconds between two hard resets.
+    /// </summary>
+    /// <remarks>
+    ///  Prevents resetting the tracking continuously, if the budget can't
+    ///  be met by discarding the learned templates.
+    /// </remarks>
+    [Tooltip("Minimum number of seconds between two hard resets.")]
+    public float minResetInterval = 60.0f;
+
+    /// <summary>
+    ///  Fraction of the budget, below which the memory has to fall, before
+    ///  exceeding the budget is handled again.
+    /// </summary>
+    [Tooltip("Fraction of the budget, below which the memory has to fall, before exceeding the budget is handled again.")]
+    public float releaseFraction = 0.9f;
+
+    /// <summary>
+    ///  Event fired with the accounted bytes whenever the budget was
+    ///  exceeded.
+    /// </summary>
+    [SerializeField]
+    public OnBudgetExceededEvent budgetExceededEvent;
+
+    private VLMemoryAccounting accounting = new VLMemoryAccounting();
+    private float lastResetTime = float.NegativeInfinity;
+    private bool budgetExceeded = false;
+
+    /// <summary>
+    ///  Returns the memory accounting of the tracking subsystems.
+    /// </summary>
+    /// <remarks>
+    ///  Subsystems, which can't be measured automatically (e.g. the model
+    ///  geometry), can be set manually.
+    /// </remarks>
+    public VLMemoryAccounting GetAccounting()
+    {
+        return this.accounting;
+    }
+
+    void HandleTrackingStates(VLTrackingState state)
+    {
+        if (state.objects == null || state.objects.Length == 0)
+        {
+            return;
+        }
+
+        // Each tracked object has its own templates and line models
+        long staticTemplates = 0;
+        long dynamicTemplates = 0;
+        long lineModels = 0;
+        foreach (VLTrackingState.TrackingObject obj in state.objects)
+        {
+            staticTemplates += obj._NumberOfTemplatesStatic;
+            dynamicTemplates += obj._NumberOfTemplatesDynamic;
+            lineModels += obj._NumberOfLineModels;
+        }
+        this.accounting.SetBytes(VLMemoryAccounting.Subsystem.StaticTemplates,
+            staticTemplates * this.estimatedBytesPerTemplate);
+        this.accounting.SetBytes(VLMemoryAccounting.Subsystem.DynamicTemplates,
+            dynamicTemplates * this.estimatedBytesPerTemplate);
+        this.accounting.SetBytes(VLMemoryAccounting.Subsystem.LineModels,
+            lineModels * this.estimatedBytesPerLineModel);
+
+        if (InitWorkerReference())
+        {
+            this.accounting.SetBytes(VLMemoryAccounting.Subsystem.ImageBuffers,
+                this.workerBehaviour.GetRuntimeCounters().imageBytes);
+        }
+
+        EnforceBudget();
+    }
+
+    void HandleTrackerInitialized(bool success)
+    {
+        if (InitWorkerReference())
+        {
+            this.accounting.SetFileBytes(
+                VLMemoryAccounting.Subsystem.CalibrationDB,
+                this.workerBehaviour.calibrationDataBaseURI);
+        }
+    }
+
+    private void EnforceBudget()
+    {
+        long budget = (long)this.budgetMegabytes * 1024 * 1024;
+        long total = this.accounting.GetTotalBytes();
+        if (budget <= 0 || total < budget * (double)this.releaseFraction)
+        {
+            this.budgetExceeded = false;
+            return;
+        }
+        if (total <= budget || !InitWorkerReference())
+        {
+            return;
+        }
+
+        // Only handle the crossing of the budget. The image buffers would
+        // otherwise be released and allocated again for every frame.
+        if (!this.budgetExceeded)
+        {
+            this.budgetExceeded = true;
+
+            if (this.budgetExceededEvent != null)
+            {
+                this.budgetExceededEvent.Invoke(total);
+            }
+
+            // Release the unused image buffers first
+            total -= this.workerBehaviour.TrimImageBuffers();
+            if (total <= budget)
+            {
+                return;
+            }
+        }
+
+        // Discard the learned templates
+        long dynamicTemplates = this.accounting.GetBytes(
+            VLMemoryAccounting.Subsystem.DynamicTemplates);
+        if (dynamicTemplates > 0 &&
+            Time.realtimeSinceStartup - this.lastResetTime >= this.minResetInterval)
+        {
+            Debug.LogWarning("[vlUnitySDK] Memory budget exceeded (" +
+                (total / (1024 * 1024)) + " MB). Discarding the learned templates.\n" +
+                this.accounting.GetReport());
+            this.lastResetTime = Time.realtimeSinceStartup;
+            this.workerBehaviour.ResetTrackingHard();
+        }
+    }
+
+    void Awake()
+    {
+        if (this.budgetExceededEvent == null)
+        {
+            this.budgetExceededEvent = new OnBudgetExceededEvent();
+        }
+    }
+
+    void OnEnable()
+    {
+        VLWorkerBehaviour.OnTrackerInitialized += HandleTrackerInitialized;
+        VLWorkerBehaviour.AddTrackingStatesListener(HandleTrackingStates,
+            VLDeliveryPolicy.LatestOnly);
+    }
+
+    void OnDisable()
+    {
+        VLWorkerBehaviour.RemoveTrackingStatesListener(HandleTrackingStates);
+        VLWorkerBehaviour.OnTrackerInitialized -= HandleTrackerInitialized;
+    }
+}
+
+/**@}*/
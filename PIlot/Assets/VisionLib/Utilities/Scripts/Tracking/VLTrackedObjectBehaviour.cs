@@ -8,7 +8,7 @@ using System;
 using System.Collections;
 
 /// <summary>
-///  This behaviour fires UnityEvents for VLWorkerBehaviour.OnTrackingStates
+///  This behaviour fires UnityEvents for VLWorkerBehaviour.OnTrackingStateInfo
 ///  events.
 /// </summary>
 /// <remarks>
@@ -63,11 +63,45 @@ public class VLTrackedObjectBehaviour : MonoBehaviour
     [SerializeField]
     public OnLostEvent justLostEvent;
 
-    private string trackedObjectName = "TrackedObject";
+    /// <summary>
+    ///  Name of the object in the tracking states.
+    /// </summary>
+    /// <remarks>
+    ///  The VisionLib reports all models of a tracker as "TrackedObject".
+    ///  Backends, which track several objects in one worker, report each
+    ///  object with its own name.
+    /// </remarks>
+    [Tooltip("Name of the object in the tracking states.")]
+    public string trackedObjectName = "TrackedObject";
+
+    /// <summary>
+    ///  Most recent tracking state as string.
+    /// </summary>
+    /// <remarks>
+    ///  Kept for compatibility. Use <see cref="GetTrackingState"/> to avoid
+    ///  string comparisons.
+    /// </remarks>
     public string previousState;
 
+    private VLTrackingStateInfo.State trackingState =
+        VLTrackingStateInfo.State.Unknown;
+
+    /// <summary>
+    ///  Returns the most recent tracking state of the tracked object.
+    /// </summary>
+    /// <returns>
+    ///  The most recent tracking state or
+    ///  <see cref="VLTrackingStateInfo.State.Unknown"/>, if no tracking state
+    ///  was received since the tracker was initialized.
+    /// </returns>
+    public VLTrackingStateInfo.State GetTrackingState()
+    {
+        return this.trackingState;
+    }
+
     void HandleTrackerInitializing()
     {
+        this.trackingState = VLTrackingStateInfo.State.Unknown;
         this.previousState = "";
     }
 
@@ -75,44 +109,41 @@ public class VLTrackedObjectBehaviour : MonoBehaviour
     {
     }
 
-    void HandleTrackingStates(VLTrackingState state)
+    void HandleTrackingStateInfo(VLTrackingStateInfo info)
     {
-        for (int i=0; i < state.objects.Length; ++i)
+        if (info.name != this.trackedObjectName)
         {
-            VLTrackingState.TrackingObject obj = state.objects[i];
+            return;
+        }
 
-            if (obj.name == this.trackedObjectName)
-            {
-                if (obj.state == "tracked")
+        bool changed = (this.trackingState != info.state);
+        switch (info.state)
+        {
+            case VLTrackingStateInfo.State.Tracked:
+                this.trackedEvent.Invoke();
+                if (changed)
                 {
-                    this.trackedEvent.Invoke();
-                    if (this.previousState != obj.state)
-                    {
-                        this.justTrackedEvent.Invoke();
-                    }
+                    this.justTrackedEvent.Invoke();
                 }
-                else if (obj.state == "critical")
+                break;
+            case VLTrackingStateInfo.State.Critical:
+                this.criticalEvent.Invoke();
+                if (changed)
                 {
-                    this.criticalEvent.Invoke();
-                    if (this.previousState != obj.state)
-                    {
-                        this.justCriticalEvent.Invoke();
-                    }
+                    this.justCriticalEvent.Invoke();
                 }
-                else if (obj.state == "lost")
+                break;
+            case VLTrackingStateInfo.State.Lost:
+                this.lostEvent.Invoke();
+                if (changed)
                 {
-                    this.lostEvent.Invoke();
-                    if (this.previousState != obj.state)
-                    {
-                        this.justLostEvent.Invoke();
-                    }
+                    this.justLostEvent.Invoke();
                 }
-
-                this.previousState = obj.state;
-
                 break;
-            }
         }
+
+        this.trackingState = info.state;
+        this.previousState = VLTrackingStateInfo.GetStateString(info.state);
     }
 
     void Awake()
@@ -147,12 +178,12 @@ public class VLTrackedObjectBehaviour : MonoBehaviour
     {
         VLWorkerBehaviour.OnTrackerInitializing += HandleTrackerInitializing;
         VLWorkerBehaviour.OnTrackerStopped += HandleTrackerStopped;
-        VLWorkerBehaviour.OnTrackingStates += HandleTrackingStates;
+        VLWorkerBehaviour.OnTrackingStateInfo += HandleTrackingStateInfo;
     }
 
     void OnDisable()
     {
-        VLWorkerBehaviour.OnTrackingStates -= HandleTrackingStates;
+        VLWorkerBehaviour.OnTrackingStateInfo -= HandleTrackingStateInfo;
         VLWorkerBehaviour.OnTrackerStopped -= HandleTrackerStopped;
         VLWorkerBehaviour.OnTrackerInitializing -= HandleTrackerInitializing;
     }
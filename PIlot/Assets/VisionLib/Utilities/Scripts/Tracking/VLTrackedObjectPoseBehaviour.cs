@@ -0,0 +1,165 @@
+/** @addtogroup vlUnitySDK
+ *  @{
+ */
+
+using UnityEngine;
+using System;
+using System.Runtime.InteropServices;
+using AOT;
+
+/// <summary>
+///  Receives the pose of a single tracked object through a named extrinsic
+///  data listener.
+/// </summary>
+/// <remarks>
+///  <para>
+///   Backends, which track several objects in one worker, deliver the pose
+///   of each object as named extrinsic data with the name of the object as
+///   key. Together with <see cref="VLTrackedObjectBehaviour"/> this allows
+///   handling every object independently, e.g. for verifying several parts
+///   at the same time.
+///  </para>
+///  <para>
+///   The model tracker of the VisionLib treats all enabled models as one
+///   object. The vlSDK stand-in in PIlot/Tools/vlSDKStandIn simulates
+///   several objects.
+///  </para>
+///  <para>
+///   The pose can be read from any thread using
+///   <see cref="GetLatestPose"/>.
+///  </para>
+/// </remarks>
+[AddComponentMenu("VisionLib/VL Tracked Object Pose Behaviour")]
+public class VLTrackedObjectPoseBehaviour : VLWorkerReferenceBehaviour
+{
+    /// <summary>
+    ///  Name of the tracked object, which is used as extrinsic data key.
+    /// </summary>
+    [Tooltip("Name of the tracked object, which is used as extrinsic data key.")]
+    public string trackedObjectName = "TrackedObject";
+
+    private string internalTrackedObjectName;
+    private bool subscribed;
+
+    private GCHandle gcHandle;
+
+    private VLPosePublisher latestPose = new VLPosePublisher();
+    private float[] modelViewMatrix = new float[16];
+
+    /// <summary>
+    ///  Returns the publisher of the most recent pose of the tracked object.
+    /// </summary>
+    public VLPosePublisher GetLatestPose()
+    {
+        return this.latestPose;
+    }
+
+    // Dispatch extrinsic data event to object instance
+    [MonoPInvokeCallback(typeof(VLWorker.ExtrinsicDataWrapperCallback))]
+    private static void DispatchNamedExtrinsicDataEvent(IntPtr handle,
+        IntPtr clientData)
+    {
+        try
+        {
+            VLExtrinsicDataWrapper extrinsicData = new VLExtrinsicDataWrapper(
+                handle, false);
+            GCHandle gcHandle = GCHandle.FromIntPtr(clientData);
+            VLTrackedObjectPoseBehaviour poseBehaviour =
+                (VLTrackedObjectPoseBehaviour)gcHandle.Target;
+            poseBehaviour.OnExtrinsicData(extrinsicData);
+            extrinsicData.Dispose();
+        }
+        catch (Exception e) // Catch all exceptions, because this is a callback
+                            // invoked from native code
+        {
+            Debug.LogError("[vlUnitySDK] " + e.GetType().Name + ": " +
+                e.Message);
+        }
+    }
+    private static VLWorker.ExtrinsicDataWrapperCallback dispatchNamedExtrinsicDataEventDelegate =
+        new VLWorker.ExtrinsicDataWrapperCallback(DispatchNamedExtrinsicDataEvent);
+
+    private void OnExtrinsicData(VLExtrinsicDataWrapper extrinsicData)
+    {
+        if (!extrinsicData.GetModelViewMatrix(this.modelViewMatrix))
+        {
+            return;
+        }
+
+        // The named extrinsic data belongs to the frame, which is currently
+        // dispatched by the VLWorkerBehaviour
+        VLFrameClock frameClock = this.workerBehaviour.GetFrameClock();
+        this.latestPose.Publish(this.modelViewMatrix,
+            extrinsicData.GetValid(), frameClock.GetFrameIndex(),
+            frameClock.GetFrameTimestamp());
+    }
+
+    private void Subscribe()
+    {
+        // Only try once per name
+        this.internalTrackedObjectName = this.trackedObjectName;
+        if (this.worker.AddNamedExtrinsicDataListener(
+            this.trackedObjectName,
+            dispatchNamedExtrinsicDataEventDelegate,
+            GCHandle.ToIntPtr(this.gcHandle)))
+        {
+            this.subscribed = true;
+        }
+        else
+        {
+            Debug.LogWarning("[vlUnitySDK] Failed to add named extrinsic data listener");
+        }
+    }
+
+    private void Unsubscribe()
+    {
+        if (this.worker != null &&
+            !this.worker.GetDisposed() &&
+            this.subscribed)
+        {
+            if (!this.worker.RemoveNamedExtrinsicDataListener(
+                this.internalTrackedObjectName,
+                dispatchNamedExtrinsicDataEventDelegate,
+                GCHandle.ToIntPtr(this.gcHandle)))
+            {
+                Debug.LogWarning("[vlUnitySDK] Failed to remove named extrinsic data listener");
+            }
+        }
+        this.subscribed = false;
+        this.internalTrackedObjectName = null;
+    }
+
+    private void OnEnable()
+    {
+        // The handle keeps the object alive while it is used as client data
+        // of the native callback
+        this.gcHandle = GCHandle.Alloc(this);
+
+        if (this.InitWorkerReference())
+        {
+            this.Subscribe();
+        }
+    }
+
+    private void OnDisable()
+    {
+        this.Unsubscribe();
+        this.gcHandle.Free();
+    }
+
+    private void Update()
+    {
+        // The worker might be created after this behaviour was enabled
+        if (!this.InitWorkerReference())
+        {
+            return;
+        }
+        if (this.trackedObjectName != this.internalTrackedObjectName)
+        {
+            this.Unsubscribe();
+            this.Subscribe();
+        }
+    }
+}
+
+/**@}*/
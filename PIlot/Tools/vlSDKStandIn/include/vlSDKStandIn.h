@@ -0,0 +1,64 @@
+/**
+ * \file vlSDKStandIn.h
+ * \brief Functions of the vlSDK stand-in, which aren't part of vlSDK.h.
+ *
+ * The VisionLib doesn't export these functions. Callers must handle a
+ * missing entry point and fall back to the functions of vlSDK.h.
+ */
+
+#ifndef VL_SDK_STAND_IN_H
+#define VL_SDK_STAND_IN_H
+
+#include <vlSDK.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+    /*!
+     * \ingroup worker
+     * \brief Creates a Worker object with concurrency options.
+     *
+     * Like ::vlNew_Worker, but the data-parallel stages of each frame are
+     * distributed over a work-stealing pool. The options are a JSON object
+     * with the following optional members:
+     * - \c threadCount: Number of threads including the tracking thread.
+     *   Zero uses all cores of the affinity mask. Default: 1.
+     * - \c affinityMask: CPUs the tracking thread and the pool may run on,
+     *   as number or as string like \c "0xf0". Zero doesn't restrict them.
+     * - \c priority: -1 for a low, 0 for an unchanged and 1 for a high
+     *   priority of the threads.
+     * - \c pipelined: Whether the next frames are acquired and
+     *   preprocessed on a separate thread, while the current frame is
+     *   tracked. Default: false.
+     * - \c pipelineDepth: Maximum number of acquired frames waiting for the
+     *   tracking. Default: 2.
+     *
+     * \param aap Pointer to an AbstractApplicationWrapper object.
+     * \param optionsJson Options as zero terminated JSON string or \c NULL.
+     * \returns Pointer to a Worker object or \c NULL, if the options are
+     *          invalid. Use vlDelete_Worker after usage to avoid memory
+     *          leaks.
+     */
+    VL_SDK_API vlWorker_t* VL_CALLINGCONVENTION vlNew_WorkerWithOptions(
+        vlAbstractApplicationWrapper_t* aap, const char optionsJson[]);
+
+    /*!
+     * \ingroup worker
+     * \brief Creates a synchronous Worker object with concurrency options.
+     *
+     * Like ::vlNew_SyncWorker with the options of ::vlNew_WorkerWithOptions,
+     * except for the pipelined mode. The frames are processed by the thread
+     * calling vlWorker_RunOnceSync together with the pool. The affinity
+     * mask and the priority are only applied to the pool, because the
+     * calling thread belongs to the application.
+     */
+    VL_SDK_API vlWorker_t* VL_CALLINGCONVENTION vlNew_SyncWorkerWithOptions(
+        vlAbstractApplicationWrapper_t* aap, const char optionsJson[]);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+#endif // VL_SDK_STAND_IN_H
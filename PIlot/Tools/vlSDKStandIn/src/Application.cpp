@@ -0,0 +1,880 @@
+// AbstractApplication, ActionPipe, DataSet and data wrappers of vlSDK.h.
+
+#include "Application.h"
+#include "Log.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+namespace vlStandIn
+{
+
+const char* const imageKey = "imgRGB";
+const char* const extrinsicDataKey = "extrinsicData";
+const char* const intrinsicDataKey = "intrinsicData";
+
+namespace
+{
+
+bool getAttribute(const AttributeMap& attributes, const char* name,
+    char value[], unsigned int maxSize)
+{
+    if (name == nullptr)
+    {
+        return false;
+    }
+    AttributeMap::const_iterator it = attributes.find(name);
+    return it != attributes.end() && copyString(it->second, value, maxSize);
+}
+
+bool setAttribute(AttributeMap& attributes, const char* name,
+    const char* value)
+{
+    if (name == nullptr || value == nullptr)
+    {
+        return false;
+    }
+    attributes[name] = value;
+    return true;
+}
+
+std::shared_ptr<Frame> getLastFrame(vlDataSetWrapper_t* dataSetWrapper)
+{
+    if (dataSetWrapper == nullptr || dataSetWrapper->aap == nullptr)
+    {
+        return std::shared_ptr<Frame>();
+    }
+    std::lock_guard<std::mutex> lock(dataSetWrapper->aap->mutex);
+    return dataSetWrapper->aap->lastFrame;
+}
+
+// Rotation matrix (row-major) from a quaternion (x, y, z, w)
+void getRotation(const float q[4], double r[9])
+{
+    double x = q[0];
+    double y = q[1];
+    double z = q[2];
+    double w = q[3];
+    r[0] = 1.0 - 2.0 * (y * y + z * z);
+    r[1] = 2.0 * (x * y - z * w);
+    r[2] = 2.0 * (x * z + y * w);
+    r[3] = 2.0 * (x * y + z * w);
+    r[4] = 1.0 - 2.0 * (x * x + z * z);
+    r[5] = 2.0 * (y * z - x * w);
+    r[6] = 2.0 * (x * z - y * w);
+    r[7] = 2.0 * (y * z + x * w);
+    r[8] = 1.0 - 2.0 * (x * x + y * y);
+}
+
+} // namespace
+
+} // namespace vlStandIn
+
+using namespace vlStandIn;
+
+extern "C"
+{
+
+// AbstractApplication
+
+vlAbstractApplicationWrapper_t* VL_CALLINGCONVENTION
+    vlNew_AbstractApplicationWrapper()
+{
+    return new vlAbstractApplicationWrapper_s();
+}
+
+void VL_CALLINGCONVENTION vlDelete_AbstractApplicationWrapper(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper)
+{
+    delete abstractApplicationWrapper;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_FoundBlockedFeatures(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper)
+{
+    // The stand-in doesn't require a license
+    (void)abstractApplicationWrapper;
+    return false;
+}
+
+bool VL_CALLINGCONVENTION
+    vlAbstractApplicationWrapper_ActivateFoundBlockedFeatures(
+        vlAbstractApplicationWrapper_t* abstractApplicationWrapper)
+{
+    return abstractApplicationWrapper != nullptr;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_GetHostID(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    char hostID[], unsigned int maxSize)
+{
+    return abstractApplicationWrapper != nullptr &&
+        copyString("vlSDKStandIn", hostID, maxSize);
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_GetBundleID(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    char bundleID[], unsigned int maxSize)
+{
+    return abstractApplicationWrapper != nullptr &&
+        copyString("com.visionlib.standin", bundleID, maxSize);
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_SetLicenseFilePath(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    const char* licenseFilePath)
+{
+    if (abstractApplicationWrapper == nullptr || licenseFilePath == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(abstractApplicationWrapper->mutex);
+    abstractApplicationWrapper->licenseFilePath = licenseFilePath;
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_SetLicenseFileData(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    const char* licenseFileData)
+{
+    return abstractApplicationWrapper != nullptr && licenseFileData != nullptr;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_GetLicenseInformation(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    char licenseInfo[], unsigned int maxSize)
+{
+    return abstractApplicationWrapper != nullptr &&
+        copyString("{\"licenseType\":\"stand-in\",\"hostID\":\"vlSDKStandIn\"}",
+            licenseInfo, maxSize);
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_AutoLoadPlugins(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    const char pluginPath[])
+{
+    // All features are built in
+    (void)pluginPath;
+    return abstractApplicationWrapper != nullptr;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_SetResourcePath(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    const char path[])
+{
+    if (abstractApplicationWrapper == nullptr || path == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(abstractApplicationWrapper->mutex);
+    abstractApplicationWrapper->resourcePath = path;
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_GetTrackerType(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    char trackerType[], unsigned int maxSize)
+{
+    if (abstractApplicationWrapper == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(abstractApplicationWrapper->mutex);
+    return !abstractApplicationWrapper->trackerType.empty() &&
+        copyString(abstractApplicationWrapper->trackerType, trackerType,
+            maxSize);
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_ClearProject(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper)
+{
+    if (abstractApplicationWrapper == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(abstractApplicationWrapper->mutex);
+    abstractApplicationWrapper->actionPipeAttributes.clear();
+    abstractApplicationWrapper->lastFrame.reset();
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_LoadProjectData(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    const char filename[])
+{
+    // Trackers are created with the createTracker command of the worker
+    (void)filename;
+    (void)abstractApplicationWrapper;
+    return false;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_LoadProjectDataFromString(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    const char str[], const char fakeFilename[])
+{
+    (void)str;
+    (void)fakeFilename;
+    (void)abstractApplicationWrapper;
+    return false;
+}
+
+vlActionPipeWrapper_t* VL_CALLINGCONVENTION
+    vlAbstractApplicationWrapper_GetActionPipe(
+        vlAbstractApplicationWrapper_t* abstractApplicationWrapper)
+{
+    if (abstractApplicationWrapper == nullptr)
+    {
+        return nullptr;
+    }
+    vlActionPipeWrapper_t* actionPipe = new vlActionPipeWrapper_s();
+    actionPipe->aap = abstractApplicationWrapper;
+    return actionPipe;
+}
+
+vlDataSetWrapper_t* VL_CALLINGCONVENTION
+    vlAbstractApplicationWrapper_GetDataSet(
+        vlAbstractApplicationWrapper_t* abstractApplicationWrapper)
+{
+    if (abstractApplicationWrapper == nullptr)
+    {
+        return nullptr;
+    }
+    vlDataSetWrapper_t* dataSet = new vlDataSetWrapper_s();
+    dataSet->aap = abstractApplicationWrapper;
+    return dataSet;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_InitActions(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper)
+{
+    return abstractApplicationWrapper != nullptr;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_ApplyActions(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper)
+{
+    return abstractApplicationWrapper != nullptr;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_RegisterThread(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper)
+{
+    return abstractApplicationWrapper != nullptr;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_GetDeviceInfo(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    char buffer[], unsigned int maxSize)
+{
+    if (abstractApplicationWrapper == nullptr)
+    {
+        return false;
+    }
+    SimulatorConfig config;
+    config.applyEnvironment();
+    char info[1024];
+    std::snprintf(info, sizeof(info),
+        "{\"os\":\"Linux\",\"manufacture\":\"VisionLib\","
+        "\"model\":\"vlSDKStandIn\",\"modelVersion\":\"1\","
+        "\"unifiedID\":\"vlSDKStandIn\",\"internalModelID\":\"vlSDKStandIn\","
+        "\"appID\":\"com.visionlib.standin\",\"numberOfProcessors\":%u,"
+        "\"nativeResX\":%u,\"nativeResY\":%u,"
+        "\"currentDisplayOrientation\":0,\"usingEventLogger\":false,"
+        "\"cameraAllowed\":true,\"availableCameras\":[{"
+        "\"deviceID\":\"StandInCamera\",\"internalID\":\"0\","
+        "\"cameraName\":\"Stand-in camera\",\"position\":\"back\","
+        "\"prefRes\":\"%ux%u\",\"availableFormats\":[{\"width\":%u,"
+        "\"height\":%u,\"compression\":\"RGB\"}]}]}",
+        std::thread::hardware_concurrency(), config.width, config.height,
+        config.width, config.height, config.width, config.height);
+    return copyString(info, buffer, maxSize);
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_AddCameraCalibrationDB(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper,
+    const char uri[])
+{
+    if (abstractApplicationWrapper == nullptr || uri == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(abstractApplicationWrapper->mutex);
+    abstractApplicationWrapper->calibrationDBs.push_back(uri);
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlAbstractApplicationWrapper_ResetCameraCalibrationDB(
+    vlAbstractApplicationWrapper_t* abstractApplicationWrapper)
+{
+    if (abstractApplicationWrapper == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(abstractApplicationWrapper->mutex);
+    abstractApplicationWrapper->calibrationDBs.clear();
+    return true;
+}
+
+// Action
+
+void VL_CALLINGCONVENTION vlDelete_ActionWrapper(vlActionWrapper_t* actionWrapper)
+{
+    delete actionWrapper;
+}
+
+bool VL_CALLINGCONVENTION vlActionWrapper_IsEnabled(
+    vlActionWrapper_t* actionWrapper)
+{
+    return actionWrapper != nullptr && actionWrapper->enabled;
+}
+
+bool VL_CALLINGCONVENTION vlActionWrapper_SetEnabled(
+    vlActionWrapper_t* actionWrapper, bool enabled)
+{
+    if (actionWrapper == nullptr)
+    {
+        return false;
+    }
+    actionWrapper->enabled = enabled;
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlActionWrapper_GetAttribute(
+    vlActionWrapper_t* actionWrapper, const char attributeName[],
+    char value[], unsigned int maxSize)
+{
+    return actionWrapper != nullptr && getAttribute(
+        actionWrapper->attributes, attributeName, value, maxSize);
+}
+
+bool VL_CALLINGCONVENTION vlActionWrapper_SetAttribute(
+    vlActionWrapper_t* actionWrapper, const char attributeName[],
+    const char value[])
+{
+    return actionWrapper != nullptr &&
+        setAttribute(actionWrapper->attributes, attributeName, value);
+}
+
+bool VL_CALLINGCONVENTION vlActionWrapper_Init(
+    vlActionWrapper_t* actionWrapper, vlDataSetWrapper_t* dataSetWrapper)
+{
+    return actionWrapper != nullptr && dataSetWrapper != nullptr;
+}
+
+bool VL_CALLINGCONVENTION vlActionWrapper_Apply(
+    vlActionWrapper_t* actionWrapper, vlDataSetWrapper_t* dataSetWrapper)
+{
+    return actionWrapper != nullptr && dataSetWrapper != nullptr;
+}
+
+// ActionPipe
+
+void VL_CALLINGCONVENTION vlDelete_ActionPipeWrapper(
+    vlActionPipeWrapper_t* actionPipeWrapper)
+{
+    delete actionPipeWrapper;
+}
+
+bool VL_CALLINGCONVENTION vlActionPipeWrapper_IsEnabled(
+    vlActionPipeWrapper_t* actionPipeWrapper)
+{
+    if (actionPipeWrapper == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(actionPipeWrapper->aap->mutex);
+    return actionPipeWrapper->aap->actionPipeEnabled;
+}
+
+bool VL_CALLINGCONVENTION vlActionPipeWrapper_SetEnabled(
+    vlActionPipeWrapper_t* actionPipeWrapper, bool enabled)
+{
+    if (actionPipeWrapper == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(actionPipeWrapper->aap->mutex);
+    actionPipeWrapper->aap->actionPipeEnabled = enabled;
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlActionPipeWrapper_GetAttribute(
+    vlActionPipeWrapper_t* actionPipeWrapper, const char attributeName[],
+    char value[], unsigned int maxSize)
+{
+    if (actionPipeWrapper == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(actionPipeWrapper->aap->mutex);
+    return getAttribute(actionPipeWrapper->aap->actionPipeAttributes,
+        attributeName, value, maxSize);
+}
+
+bool VL_CALLINGCONVENTION vlActionPipeWrapper_SetAttribute(
+    vlActionPipeWrapper_t* actionPipeWrapper, const char attributeName[],
+    const char value[])
+{
+    if (actionPipeWrapper == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(actionPipeWrapper->aap->mutex);
+    return setAttribute(actionPipeWrapper->aap->actionPipeAttributes,
+        attributeName, value);
+}
+
+vlActionWrapper_t* VL_CALLINGCONVENTION vlActionPipeWrapper_FindAction(
+    vlActionPipeWrapper_t* actionPipeWrapper, const char key[])
+{
+    // The simulator doesn't consist of Actions
+    (void)actionPipeWrapper;
+    (void)key;
+    return nullptr;
+}
+
+vlActionPipeWrapper_t* VL_CALLINGCONVENTION vlActionPipeWrapper_FindActionPipe(
+    vlActionPipeWrapper_t* actionPipeWrapper, const char key[])
+{
+    (void)actionPipeWrapper;
+    (void)key;
+    return nullptr;
+}
+
+bool VL_CALLINGCONVENTION vlActionPipeWrapper_Init(
+    vlActionPipeWrapper_t* actionPipeWrapper,
+    vlDataSetWrapper_t* dataSetWrapper)
+{
+    return actionPipeWrapper != nullptr && dataSetWrapper != nullptr;
+}
+
+bool VL_CALLINGCONVENTION vlActionPipeWrapper_Apply(
+    vlActionPipeWrapper_t* actionPipeWrapper,
+    vlDataSetWrapper_t* dataSetWrapper)
+{
+    return actionPipeWrapper != nullptr && dataSetWrapper != nullptr;
+}
+
+// DataBase
+
+void VL_CALLINGCONVENTION vlDelete_DataBaseWrapper(
+    vlDataBaseWrapper_t* dataBaseWrapper)
+{
+    delete dataBaseWrapper;
+}
+
+bool VL_CALLINGCONVENTION vlDataBaseWrapper_GetAttribute(
+    vlDataBaseWrapper_t* dataBaseWrapper, const char attributeName[],
+    char value[], unsigned int maxSize)
+{
+    return dataBaseWrapper != nullptr && getAttribute(
+        dataBaseWrapper->attributes, attributeName, value, maxSize);
+}
+
+bool VL_CALLINGCONVENTION vlDataBaseWrapper_SetAttribute(
+    vlDataBaseWrapper_t* dataBaseWrapper, const char attributeName[],
+    const char value[])
+{
+    return dataBaseWrapper != nullptr &&
+        setAttribute(dataBaseWrapper->attributes, attributeName, value);
+}
+
+// DataSet
+
+void VL_CALLINGCONVENTION vlDelete_DataSetWrapper(
+    vlDataSetWrapper_t* dataSetWrapper)
+{
+    delete dataSetWrapper;
+}
+
+vlDataBaseWrapper_t* VL_CALLINGCONVENTION vlDataSetWrapper_GetDataBase(
+    vlDataSetWrapper_t* dataSetWrapper, const char key[])
+{
+    (void)dataSetWrapper;
+    (void)key;
+    return nullptr;
+}
+
+vlDataSetWrapper_t* VL_CALLINGCONVENTION vlDataSetWrapper_GetDataSet(
+    vlDataSetWrapper_t* dataSetWrapper, const char key[])
+{
+    (void)dataSetWrapper;
+    (void)key;
+    return nullptr;
+}
+
+vlImageWrapper_t* VL_CALLINGCONVENTION vlDataSetWrapper_GetImage(
+    vlDataSetWrapper_t* dataSetWrapper, const char key[])
+{
+    if (key == nullptr || std::strcmp(key, imageKey) != 0)
+    {
+        return nullptr;
+    }
+    std::shared_ptr<Frame> frame = getLastFrame(dataSetWrapper);
+    return frame ? new vlImageWrapper_s(frame->image) : nullptr;
+}
+
+vlExtrinsicDataWrapper_t* VL_CALLINGCONVENTION vlDataSetWrapper_GetExtrinsicData(
+    vlDataSetWrapper_t* dataSetWrapper, const char key[])
+{
+    std::shared_ptr<Frame> frame = getLastFrame(dataSetWrapper);
+    if (key == nullptr || !frame)
+    {
+        return nullptr;
+    }
+    if (std::strcmp(key, extrinsicDataKey) == 0)
+    {
+        return new vlExtrinsicDataWrapper_s(frame->extrinsicData);
+    }
+    // Poses of the individual objects
+    for (size_t i = 0; i < frame->objects.size(); ++i)
+    {
+        if (frame->objects[i].name == key)
+        {
+            return new vlExtrinsicDataWrapper_s(frame->objects[i].extrinsicData);
+        }
+    }
+    return nullptr;
+}
+
+vlIntrinsicDataWrapper_t* VL_CALLINGCONVENTION vlDataSetWrapper_GetIntrinsicData(
+    vlDataSetWrapper_t* dataSetWrapper, const char key[])
+{
+    if (key == nullptr || std::strcmp(key, intrinsicDataKey) != 0)
+    {
+        return nullptr;
+    }
+    std::shared_ptr<Frame> frame = getLastFrame(dataSetWrapper);
+    return frame ? new vlIntrinsicDataWrapper_s(frame->intrinsicData) : nullptr;
+}
+
+// Image
+
+void VL_CALLINGCONVENTION vlDelete_ImageWrapper(vlImageWrapper_t* imageWrapper)
+{
+    delete imageWrapper;
+}
+
+unsigned int VL_CALLINGCONVENTION vlImageWrapper_GetFormat(
+    vlImageWrapper_t* imageWrapper)
+{
+    return imageWrapper != nullptr ? imageWrapper->format :
+        VL_IMAGE_FORMAT_UNDEFINED;
+}
+
+unsigned int VL_CALLINGCONVENTION vlImageWrapper_GetBytesPerPixel(
+    vlImageWrapper_t* imageWrapper)
+{
+    return imageWrapper != nullptr ? imageWrapper->getBytesPerPixel() : 0;
+}
+
+unsigned int VL_CALLINGCONVENTION vlImageWrapper_GetWidth(
+    vlImageWrapper_t* imageWrapper)
+{
+    return imageWrapper != nullptr ? imageWrapper->width : 0;
+}
+
+unsigned int VL_CALLINGCONVENTION vlImageWrapper_GetHeight(
+    vlImageWrapper_t* imageWrapper)
+{
+    return imageWrapper != nullptr ? imageWrapper->height : 0;
+}
+
+bool VL_CALLINGCONVENTION vlImageWrapper_CopyToBuffer(
+    vlImageWrapper_t* imageWrapper, unsigned char buffer[],
+    unsigned int bufferSize)
+{
+    if (imageWrapper == nullptr || buffer == nullptr ||
+        bufferSize < imageWrapper->pixels.size())
+    {
+        return false;
+    }
+    std::memcpy(buffer, imageWrapper->pixels.data(),
+        imageWrapper->pixels.size());
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlImageWrapper_CopyFromBufferWithFormat(
+    vlImageWrapper_t* imageWrapper, const unsigned char buffer[],
+    unsigned int width, unsigned int height, vlImageFormat imageFormat)
+{
+    if (imageWrapper == nullptr || buffer == nullptr ||
+        imageFormat == VL_IMAGE_FORMAT_UNDEFINED)
+    {
+        return false;
+    }
+    imageWrapper->format = imageFormat;
+    imageWrapper->width = width;
+    imageWrapper->height = height;
+    imageWrapper->pixels.assign(buffer, buffer +
+        static_cast<size_t>(width) * height * imageWrapper->getBytesPerPixel());
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlImageWrapper_CopyFromBuffer(
+    vlImageWrapper_t* imageWrapper, const unsigned char buffer[],
+    unsigned int width, unsigned int height)
+{
+    // Keep the current format
+    return imageWrapper != nullptr && vlImageWrapper_CopyFromBufferWithFormat(
+        imageWrapper, buffer, width, height, imageWrapper->format);
+}
+
+// ExtrinsicData
+
+void VL_CALLINGCONVENTION vlDelete_ExtrinsicDataWrapper(
+    vlExtrinsicDataWrapper_t* extrinsicDataWrapper)
+{
+    delete extrinsicDataWrapper;
+}
+
+bool VL_CALLINGCONVENTION vlExtrinsicDataWrapper_GetValid(
+    vlExtrinsicDataWrapper_t* extrinsicDataWrapper)
+{
+    return extrinsicDataWrapper != nullptr && extrinsicDataWrapper->valid;
+}
+
+bool VL_CALLINGCONVENTION vlExtrinsicDataWrapper_GetModelViewMatrix(
+    vlExtrinsicDataWrapper_t* extrinsicDataWrapper, float matrix[],
+    unsigned int matrixElementCount)
+{
+    if (extrinsicDataWrapper == nullptr || matrix == nullptr ||
+        matrixElementCount != 16)
+    {
+        return false;
+    }
+
+    // Convert from the computer vision camera (y down, z forward) into the
+    // OpenGL camera (y up, z backward) and store in column-major order
+    double r[9];
+    getRotation(extrinsicDataWrapper->q, r);
+    const double flip[3] = {1.0, -1.0, -1.0};
+    for (int row = 0; row < 3; ++row)
+    {
+        for (int col = 0; col < 3; ++col)
+        {
+            matrix[col * 4 + row] = static_cast<float>(flip[row] * r[row * 3 + col]);
+        }
+        matrix[12 + row] =
+            static_cast<float>(flip[row] * extrinsicDataWrapper->t[row]);
+        matrix[row * 4 + 3] = 0.0f;
+    }
+    matrix[15] = 1.0f;
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlExtrinsicDataWrapper_GetT(
+    vlExtrinsicDataWrapper_t* extrinsicDataWrapper, float t[],
+    unsigned int elementCount)
+{
+    if (extrinsicDataWrapper == nullptr || t == nullptr || elementCount != 3)
+    {
+        return false;
+    }
+    std::memcpy(t, extrinsicDataWrapper->t, sizeof(extrinsicDataWrapper->t));
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlExtrinsicDataWrapper_SetT(
+    vlExtrinsicDataWrapper_t* extrinsicDataWrapper, const float t[],
+    unsigned int elementCount)
+{
+    if (extrinsicDataWrapper == nullptr || t == nullptr || elementCount != 3)
+    {
+        return false;
+    }
+    std::memcpy(extrinsicDataWrapper->t, t, sizeof(extrinsicDataWrapper->t));
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlExtrinsicDataWrapper_GetR(
+    vlExtrinsicDataWrapper_t* extrinsicDataWrapper, float q[],
+    unsigned int elementCount)
+{
+    if (extrinsicDataWrapper == nullptr || q == nullptr || elementCount != 4)
+    {
+        return false;
+    }
+    std::memcpy(q, extrinsicDataWrapper->q, sizeof(extrinsicDataWrapper->q));
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlExtrinsicDataWrapper_SetR(
+    vlExtrinsicDataWrapper_t* extrinsicDataWrapper, const float q[],
+    unsigned int elementCount)
+{
+    if (extrinsicDataWrapper == nullptr || q == nullptr || elementCount != 4)
+    {
+        return false;
+    }
+    std::memcpy(extrinsicDataWrapper->q, q, sizeof(extrinsicDataWrapper->q));
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlExtrinsicDataWrapper_GetCamPosWorld(
+    vlExtrinsicDataWrapper_t* extrinsicDataWrapper, float t[],
+    unsigned int elementCount)
+{
+    if (extrinsicDataWrapper == nullptr || t == nullptr || elementCount != 3)
+    {
+        return false;
+    }
+
+    // -R^T * t
+    double r[9];
+    getRotation(extrinsicDataWrapper->q, r);
+    for (int i = 0; i < 3; ++i)
+    {
+        t[i] = static_cast<float>(-(r[i] * extrinsicDataWrapper->t[0] +
+            r[3 + i] * extrinsicDataWrapper->t[1] +
+            r[6 + i] * extrinsicDataWrapper->t[2]));
+    }
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlExtrinsicDataWrapper_SetCamPosWorld(
+    vlExtrinsicDataWrapper_t* extrinsicDataWrapper, const float t[],
+    unsigned int elementCount)
+{
+    if (extrinsicDataWrapper == nullptr || t == nullptr || elementCount != 3)
+    {
+        return false;
+    }
+
+    // t = -R * position
+    double r[9];
+    getRotation(extrinsicDataWrapper->q, r);
+    for (int i = 0; i < 3; ++i)
+    {
+        extrinsicDataWrapper->t[i] = static_cast<float>(-(r[3 * i] * t[0] +
+            r[3 * i + 1] * t[1] + r[3 * i + 2] * t[2]));
+    }
+    return true;
+}
+
+// IntrinsicData
+
+void VL_CALLINGCONVENTION vlDelete_IntrinsicDataWrapper(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper)
+{
+    delete intrinsicDataWrapper;
+}
+
+unsigned int VL_CALLINGCONVENTION vlIntrinsicDataWrapper_GetWidth(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper)
+{
+    return intrinsicDataWrapper != nullptr ? intrinsicDataWrapper->width : 0;
+}
+
+unsigned int VL_CALLINGCONVENTION vlIntrinsicDataWrapper_GetHeight(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper)
+{
+    return intrinsicDataWrapper != nullptr ? intrinsicDataWrapper->height : 0;
+}
+
+double VL_CALLINGCONVENTION vlIntrinsicDataWrapper_GetFxNorm(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper)
+{
+    return intrinsicDataWrapper != nullptr ? intrinsicDataWrapper->fxNorm : 0.0;
+}
+
+double VL_CALLINGCONVENTION vlIntrinsicDataWrapper_GetFyNorm(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper)
+{
+    return intrinsicDataWrapper != nullptr ? intrinsicDataWrapper->fyNorm : 0.0;
+}
+
+double VL_CALLINGCONVENTION vlIntrinsicDataWrapper_GetSkewNorm(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper)
+{
+    return intrinsicDataWrapper != nullptr ?
+        intrinsicDataWrapper->skewNorm : 0.0;
+}
+
+double VL_CALLINGCONVENTION vlIntrinsicDataWrapper_GetCxNorm(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper)
+{
+    return intrinsicDataWrapper != nullptr ? intrinsicDataWrapper->cxNorm : 0.0;
+}
+
+double VL_CALLINGCONVENTION vlIntrinsicDataWrapper_GetCyNorm(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper)
+{
+    return intrinsicDataWrapper != nullptr ? intrinsicDataWrapper->cyNorm : 0.0;
+}
+
+bool VL_CALLINGCONVENTION vlIntrinsicDataWrapper_GetCalibrated(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper)
+{
+    return intrinsicDataWrapper != nullptr && intrinsicDataWrapper->calibrated;
+}
+
+double VL_CALLINGCONVENTION vlIntrinsicDataWrapper_GetCalibrationError(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper)
+{
+    return intrinsicDataWrapper != nullptr ?
+        intrinsicDataWrapper->calibrationError : 0.0;
+}
+
+bool VL_CALLINGCONVENTION vlIntrinsicDataWrapper_GetRadialDistortion(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper, double k[],
+    unsigned int elementCount)
+{
+    if (intrinsicDataWrapper == nullptr || k == nullptr || elementCount != 5)
+    {
+        return false;
+    }
+    std::memcpy(k, intrinsicDataWrapper->k, sizeof(intrinsicDataWrapper->k));
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlIntrinsicDataWrapper_SetRadialDistortion(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper, const double k[],
+    unsigned int elementCount)
+{
+    if (intrinsicDataWrapper == nullptr || k == nullptr || elementCount != 5)
+    {
+        return false;
+    }
+    std::memcpy(intrinsicDataWrapper->k, k, sizeof(intrinsicDataWrapper->k));
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlIntrinsicDataWrapper_GetProjectionMatrix(
+    vlIntrinsicDataWrapper_t* intrinsicDataWrapper, float nearFact,
+    float farFact, unsigned int screenWidth, unsigned int screenHeight,
+    unsigned int renderRotation, unsigned int mode, float matrix[],
+    unsigned int matrixElementCount)
+{
+    if (intrinsicDataWrapper == nullptr || matrix == nullptr ||
+        matrixElementCount != 16 || farFact <= nearFact)
+    {
+        return false;
+    }
+
+    // OpenGL projection of the normalized intrinsics. The screen size, the
+    // render rotation and the mode aren't simulated.
+    (void)screenWidth;
+    (void)screenHeight;
+    (void)renderRotation;
+    (void)mode;
+    double n = nearFact;
+    double f = farFact;
+    for (int i = 0; i < 16; ++i)
+    {
+        matrix[i] = 0.0f;
+    }
+    matrix[0] = static_cast<float>(2.0 * intrinsicDataWrapper->fxNorm);
+    matrix[4] = static_cast<float>(2.0 * intrinsicDataWrapper->skewNorm);
+    matrix[5] = static_cast<float>(2.0 * intrinsicDataWrapper->fyNorm);
+    matrix[8] = static_cast<float>(1.0 - 2.0 * intrinsicDataWrapper->cxNorm);
+    matrix[9] = static_cast<float>(2.0 * intrinsicDataWrapper->cyNorm - 1.0);
+    matrix[10] = static_cast<float>(-(f + n) / (f - n));
+    matrix[11] = -1.0f;
+    matrix[14] = static_cast<float>(-2.0 * f * n / (f - n));
+    return true;
+}
+
+} // extern "C"
@@ -0,0 +1,60 @@
+#ifndef VL_STAND_IN_APPLICATION_H
+#define VL_STAND_IN_APPLICATION_H
+
+#include "Simulator.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vlStandIn
+{
+
+/*! Key of the current image in the DataSet. */
+extern const char* const imageKey;
+/*! Key of the current extrinsic data in the DataSet. */
+extern const char* const extrinsicDataKey;
+/*! Key of the current intrinsic data in the DataSet. */
+extern const char* const intrinsicDataKey;
+
+typedef std::map<std::string, std::string> AttributeMap;
+
+} // namespace vlStandIn
+
+struct vlAbstractApplicationWrapper_s
+{
+    std::mutex mutex;
+    std::string licenseFilePath;
+    std::string resourcePath;
+    std::string trackerType;
+    std::vector<std::string> calibrationDBs;
+    vlStandIn::AttributeMap actionPipeAttributes;
+    bool actionPipeEnabled = true;
+    /*! Latest frame of the workers, which is exposed through the DataSet. */
+    std::shared_ptr<vlStandIn::Frame> lastFrame;
+};
+
+struct vlActionPipeWrapper_s
+{
+    vlAbstractApplicationWrapper_s* aap = nullptr;
+};
+
+struct vlActionWrapper_s
+{
+    bool enabled = true;
+    vlStandIn::AttributeMap attributes;
+};
+
+struct vlDataBaseWrapper_s
+{
+    vlStandIn::AttributeMap attributes;
+};
+
+struct vlDataSetWrapper_s
+{
+    vlAbstractApplicationWrapper_s* aap = nullptr;
+};
+
+#endif // VL_STAND_IN_APPLICATION_H
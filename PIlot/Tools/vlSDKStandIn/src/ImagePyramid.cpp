@@ -0,0 +1,180 @@
+#include "ImagePyramid.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+namespace vlStandIn
+{
+
+namespace
+{
+
+// Number of rows, which are processed at once
+const size_t rowsPerRange = 16;
+
+// Smallest width and height of a level
+const unsigned int minLevelSize = 8;
+
+size_t alignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+const size_t ImagePyramid::alignment;
+
+void ImagePyramid::compute(const unsigned char* pixels, unsigned int width,
+    unsigned int height, unsigned int bytesPerPixel, unsigned int levelCount,
+    WorkStealingPool& pool)
+{
+    // Layout of the planes. A stride of whole cache lines keeps the rows of
+    // the grey values (1 byte) and of the Laplace responses (2 bytes)
+    // aligned.
+    struct Offsets
+    {
+        size_t grey;
+        size_t gradient;
+        size_t laplace;
+    };
+    this->levels.clear();
+    std::vector<Offsets> offsets;
+    size_t size = 0;
+    unsigned int levelWidth = width;
+    unsigned int levelHeight = height;
+    while (this->levels.size() < levelCount &&
+        levelWidth >= minLevelSize && levelHeight >= minLevelSize)
+    {
+        Level level;
+        level.width = levelWidth;
+        level.height = levelHeight;
+        level.stride = alignUp(levelWidth, alignment);
+        size_t planeSize = level.stride * levelHeight;
+        Offsets levelOffsets;
+        levelOffsets.grey = size;
+        levelOffsets.gradient = levelOffsets.grey + planeSize;
+        levelOffsets.laplace = levelOffsets.gradient + planeSize;
+        size = levelOffsets.laplace + planeSize * sizeof(short);
+        this->levels.push_back(level);
+        offsets.push_back(levelOffsets);
+        levelWidth /= 2;
+        levelHeight /= 2;
+    }
+
+    this->storage.resize(size + alignment);
+    std::uintptr_t address =
+        reinterpret_cast<std::uintptr_t>(this->storage.data());
+    unsigned char* base = this->storage.data() +
+        (alignUp(address, alignment) - address);
+
+    for (size_t i = 0; i < this->levels.size(); ++i)
+    {
+        Level& level = this->levels[i];
+        unsigned char* grey = base + offsets[i].grey;
+        unsigned char* gradient = base + offsets[i].gradient;
+        short* laplace = reinterpret_cast<short*>(base + offsets[i].laplace);
+        level.grey = grey;
+        level.gradient = gradient;
+        level.laplace = laplace;
+
+        size_t stride = level.stride;
+        unsigned int levelWidth = level.width;
+        if (i == 0)
+        {
+            // Grey values of the image with the weights of BT.601
+            pool.parallelFor(level.height, rowsPerRange,
+                [=](size_t begin, size_t end)
+            {
+                for (size_t y = begin; y < end; ++y)
+                {
+                    const unsigned char* src =
+                        pixels + y * width * bytesPerPixel;
+                    unsigned char* dst = grey + y * stride;
+                    for (unsigned int x = 0; x < levelWidth; ++x)
+                    {
+                        dst[x] = bytesPerPixel < 3 ? src[0] :
+                            static_cast<unsigned char>((77 * src[0] +
+                                150 * src[1] + 29 * src[2]) >> 8);
+                        src += bytesPerPixel;
+                    }
+                }
+            });
+        }
+        else
+        {
+            // Mean of 2x2 pixels of the previous level
+            const Level& previous = this->levels[i - 1];
+            const unsigned char* previousGrey = previous.grey;
+            size_t previousStride = previous.stride;
+            pool.parallelFor(level.height, rowsPerRange,
+                [=](size_t begin, size_t end)
+            {
+                for (size_t y = begin; y < end; ++y)
+                {
+                    const unsigned char* src0 =
+                        previousGrey + 2 * y * previousStride;
+                    const unsigned char* src1 = src0 + previousStride;
+                    unsigned char* dst = grey + y * stride;
+                    for (unsigned int x = 0; x < levelWidth; ++x)
+                    {
+                        dst[x] = static_cast<unsigned char>((src0[2 * x] +
+                            src0[2 * x + 1] + src1[2 * x] +
+                            src1[2 * x + 1] + 2) >> 2);
+                    }
+                }
+            });
+        }
+
+        computeFilters(level, gradient, laplace, pool);
+    }
+}
+
+size_t ImagePyramid::getLevelCount() const
+{
+    return this->levels.size();
+}
+
+const ImagePyramid::Level& ImagePyramid::getLevel(size_t index) const
+{
+    return this->levels[index];
+}
+
+void ImagePyramid::computeFilters(const Level& level, unsigned char* gradient,
+    short* laplace, WorkStealingPool& pool) const
+{
+    // The filters need all 4 neighbours, so the border stays zero
+    const unsigned char* grey = level.grey;
+    size_t stride = level.stride;
+    unsigned int width = level.width;
+    unsigned int height = level.height;
+    pool.parallelFor(height, rowsPerRange, [=](size_t begin, size_t end)
+    {
+        for (size_t y = begin; y < end; ++y)
+        {
+            unsigned char* gradientRow = gradient + y * stride;
+            short* laplaceRow = laplace + y * stride;
+            std::fill(gradientRow, gradientRow + width, 0);
+            std::fill(laplaceRow, laplaceRow + width, 0);
+            if (y == 0 || y + 1 >= height)
+            {
+                continue;
+            }
+
+            const unsigned char* row = grey + y * stride;
+            const unsigned char* above = row - stride;
+            const unsigned char* below = row + stride;
+            for (unsigned int x = 1; x + 1 < width; ++x)
+            {
+                int gx = row[x + 1] - row[x - 1];
+                int gy = below[x] - above[x];
+                gradientRow[x] = static_cast<unsigned char>(
+                    (std::abs(gx) + std::abs(gy)) >> 1);
+                laplaceRow[x] = static_cast<short>(4 * row[x] - row[x - 1] -
+                    row[x + 1] - above[x] - below[x]);
+            }
+        }
+    });
+}
+
+} // namespace vlStandIn
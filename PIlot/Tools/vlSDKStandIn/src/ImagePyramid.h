@@ -0,0 +1,72 @@
+#ifndef VL_STAND_IN_IMAGE_PYRAMID_H
+#define VL_STAND_IN_IMAGE_PYRAMID_H
+
+#include "ThreadPool.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace vlStandIn
+{
+
+/*!
+ * \brief Grey value pyramid with the gradients and Laplace responses of
+ * every level.
+ *
+ * The pyramid is computed once per frame and read by the edge search of all
+ * tracked objects, so an additional object only adds its own search. Every
+ * row of every plane starts at a cache line, therefore the threads, which
+ * compute different row ranges, never write to the same cache line.
+ */
+class ImagePyramid
+{
+public:
+    /*! Alignment of the rows in bytes. */
+    static const size_t alignment = 64;
+
+    struct Level
+    {
+        unsigned int width = 0;
+        unsigned int height = 0;
+        /*! Elements per row of each plane. */
+        size_t stride = 0;
+        /*! Grey values. */
+        const unsigned char* grey = nullptr;
+        /*! Sum of the absolute central differences divided by two. */
+        const unsigned char* gradient = nullptr;
+        /*! Response of the 4-neighbour Laplace filter. */
+        const short* laplace = nullptr;
+    };
+
+    ImagePyramid() = default;
+    // The levels point into the storage
+    ImagePyramid(const ImagePyramid&) = delete;
+    ImagePyramid& operator=(const ImagePyramid&) = delete;
+
+    /*!
+     * \brief Computes \p levelCount levels from an image with 1 (grey), 3
+     * (RGB) or 4 (RGBA) bytes per pixel.
+     *
+     * Each level halves the size of the previous one. The computation stops
+     * early, if a level would be smaller than 8 pixels. The rows are
+     * processed in parallel.
+     */
+    void compute(const unsigned char* pixels, unsigned int width,
+        unsigned int height, unsigned int bytesPerPixel,
+        unsigned int levelCount, WorkStealingPool& pool);
+
+    size_t getLevelCount() const;
+    const Level& getLevel(size_t index) const;
+
+private:
+    std::vector<Level> levels;
+    // Holds all planes. The planes start at the first aligned byte.
+    std::vector<unsigned char> storage;
+
+    void computeFilters(const Level& level, unsigned char* gradient,
+        short* laplace, WorkStealingPool& pool) const;
+};
+
+} // namespace vlStandIn
+
+#endif // VL_STAND_IN_IMAGE_PYRAMID_H
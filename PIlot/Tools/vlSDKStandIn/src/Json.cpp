@@ -0,0 +1,373 @@
+#include "Json.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace vlStandIn
+{
+
+namespace
+{
+
+class Parser
+{
+public:
+    explicit Parser(const std::string& text) : text(text), pos(0)
+    {
+    }
+
+    bool parseDocument(JsonValue& value)
+    {
+        if (!parseValue(value))
+        {
+            return false;
+        }
+        skipWhitespace();
+        return this->pos == this->text.size();
+    }
+
+private:
+    const std::string& text;
+    size_t pos;
+
+    void skipWhitespace()
+    {
+        while (this->pos < this->text.size() &&
+            (this->text[this->pos] == ' ' || this->text[this->pos] == '\t' ||
+             this->text[this->pos] == '\n' || this->text[this->pos] == '\r'))
+        {
+            ++this->pos;
+        }
+    }
+
+    bool consume(const char* literal)
+    {
+        size_t i = 0;
+        for (; literal[i] != '\0'; ++i)
+        {
+            if (this->pos + i >= this->text.size() ||
+                this->text[this->pos + i] != literal[i])
+            {
+                return false;
+            }
+        }
+        this->pos += i;
+        return true;
+    }
+
+    bool parseValue(JsonValue& value)
+    {
+        skipWhitespace();
+        if (this->pos >= this->text.size())
+        {
+            return false;
+        }
+
+        char c = this->text[this->pos];
+        if (c == '{')
+        {
+            return parseObject(value);
+        }
+        if (c == '[')
+        {
+            return parseArray(value);
+        }
+        if (c == '"')
+        {
+            value.type = JsonValue::String;
+            return parseString(value.string);
+        }
+        if (consume("true"))
+        {
+            value.type = JsonValue::Bool;
+            value.boolean = true;
+            return true;
+        }
+        if (consume("false"))
+        {
+            value.type = JsonValue::Bool;
+            value.boolean = false;
+            return true;
+        }
+        if (consume("null"))
+        {
+            value.type = JsonValue::Null;
+            return true;
+        }
+        return parseNumber(value);
+    }
+
+    bool parseNumber(JsonValue& value)
+    {
+        const char* begin = this->text.c_str() + this->pos;
+        char* end = nullptr;
+        double number = std::strtod(begin, &end);
+        if (end == begin)
+        {
+            return false;
+        }
+        this->pos += static_cast<size_t>(end - begin);
+        value.type = JsonValue::Number;
+        value.number = number;
+        return true;
+    }
+
+    static void appendUtf8(std::string& str, unsigned int codePoint)
+    {
+        if (codePoint < 0x80)
+        {
+            str += static_cast<char>(codePoint);
+        }
+        else if (codePoint < 0x800)
+        {
+            str += static_cast<char>(0xc0 | (codePoint >> 6));
+            str += static_cast<char>(0x80 | (codePoint & 0x3f));
+        }
+        else
+        {
+            str += static_cast<char>(0xe0 | (codePoint >> 12));
+            str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+            str += static_cast<char>(0x80 | (codePoint & 0x3f));
+        }
+    }
+
+    bool parseString(std::string& str)
+    {
+        // Skip the opening quote
+        ++this->pos;
+        str.clear();
+        while (this->pos < this->text.size())
+        {
+            char c = this->text[this->pos++];
+            if (c == '"')
+            {
+                return true;
+            }
+            if (c != '\\')
+            {
+                str += c;
+                continue;
+            }
+            if (this->pos >= this->text.size())
+            {
+                return false;
+            }
+            char escaped = this->text[this->pos++];
+            switch (escaped)
+            {
+                case 'n': str += '\n'; break;
+                case 't': str += '\t'; break;
+                case 'r': str += '\r'; break;
+                case 'b': str += '\b'; break;
+                case 'f': str += '\f'; break;
+                case 'u':
+                {
+                    if (this->pos + 4 > this->text.size())
+                    {
+                        return false;
+                    }
+                    std::string hex = this->text.substr(this->pos, 4);
+                    this->pos += 4;
+                    appendUtf8(str, static_cast<unsigned int>(
+                        std::strtoul(hex.c_str(), nullptr, 16)));
+                    break;
+                }
+                default: str += escaped; break;
+            }
+        }
+        return false;
+    }
+
+    bool parseArray(JsonValue& value)
+    {
+        // Skip the opening bracket
+        ++this->pos;
+        value.type = JsonValue::Array;
+        skipWhitespace();
+        if (consume("]"))
+        {
+            return true;
+        }
+        while (true)
+        {
+            value.array.push_back(JsonValue());
+            if (!parseValue(value.array.back()))
+            {
+                return false;
+            }
+            skipWhitespace();
+            if (consume("]"))
+            {
+                return true;
+            }
+            if (!consume(","))
+            {
+                return false;
+            }
+        }
+    }
+
+    bool parseObject(JsonValue& value)
+    {
+        // Skip the opening brace
+        ++this->pos;
+        value.type = JsonValue::Object;
+        skipWhitespace();
+        if (consume("}"))
+        {
+            return true;
+        }
+        while (true)
+        {
+            skipWhitespace();
+            if (this->pos >= this->text.size() || this->text[this->pos] != '"')
+            {
+                return false;
+            }
+            value.object.push_back(std::make_pair(std::string(), JsonValue()));
+            if (!parseString(value.object.back().first))
+            {
+                return false;
+            }
+            skipWhitespace();
+            if (!consume(":") || !parseValue(value.object.back().second))
+            {
+                return false;
+            }
+            skipWhitespace();
+            if (consume("}"))
+            {
+                return true;
+            }
+            if (!consume(","))
+            {
+                return false;
+            }
+        }
+    }
+};
+
+} // namespace
+
+const JsonValue* JsonValue::find(const std::string& key) const
+{
+    for (size_t i = 0; i < this->object.size(); ++i)
+    {
+        if (this->object[i].first == key)
+        {
+            return &this->object[i].second;
+        }
+    }
+    return nullptr;
+}
+
+double JsonValue::getNumber(const std::string& key, double defaultValue) const
+{
+    const JsonValue* value = find(key);
+    if (value == nullptr)
+    {
+        return defaultValue;
+    }
+    if (value->type == Number)
+    {
+        return value->number;
+    }
+    if (value->type == String)
+    {
+        return std::atof(value->string.c_str());
+    }
+    return defaultValue;
+}
+
+std::string JsonValue::getString(const std::string& key,
+    const std::string& defaultValue) const
+{
+    const JsonValue* value = find(key);
+    return (value != nullptr && value->type == String) ?
+        value->string : defaultValue;
+}
+
+bool JsonValue::getBool(const std::string& key, bool defaultValue) const
+{
+    const JsonValue* value = find(key);
+    return (value != nullptr && value->type == Bool) ?
+        value->boolean : defaultValue;
+}
+
+bool parseJson(const std::string& text, JsonValue& value)
+{
+    value = JsonValue();
+    return Parser(text).parseDocument(value);
+}
+
+std::string quoteJson(const std::string& str)
+{
+    std::string result = "\"";
+    for (size_t i = 0; i < str.size(); ++i)
+    {
+        unsigned char c = static_cast<unsigned char>(str[i]);
+        switch (c)
+        {
+            case '"': result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            default:
+                if (c < 0x20)
+                {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                    result += buffer;
+                }
+                else
+                {
+                    result += static_cast<char>(c);
+                }
+        }
+    }
+    result += '"';
+    return result;
+}
+
+std::string toJson(const JsonValue& value)
+{
+    switch (value.type)
+    {
+        case JsonValue::Null:
+            return "null";
+        case JsonValue::Bool:
+            return value.boolean ? "true" : "false";
+        case JsonValue::Number:
+        {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.17g", value.number);
+            return buffer;
+        }
+        case JsonValue::String:
+            return quoteJson(value.string);
+        case JsonValue::Array:
+        {
+            std::string result = "[";
+            for (size_t i = 0; i < value.array.size(); ++i)
+            {
+                result += (i > 0 ? "," : "") + toJson(value.array[i]);
+            }
+            return result + "]";
+        }
+        case JsonValue::Object:
+        {
+            std::string result = "{";
+            for (size_t i = 0; i < value.object.size(); ++i)
+            {
+                result += (i > 0 ? "," : "") +
+                    quoteJson(value.object[i].first) + ":" +
+                    toJson(value.object[i].second);
+            }
+            return result + "}";
+        }
+    }
+    return "null";
+}
+
+} // namespace vlStandIn
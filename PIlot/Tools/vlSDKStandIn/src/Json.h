@@ -0,0 +1,63 @@
+#ifndef VL_STAND_IN_JSON_H
+#define VL_STAND_IN_JSON_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vlStandIn
+{
+
+/*!
+ * \brief Minimal JSON value used for parsing commands and configurations.
+ */
+struct JsonValue
+{
+    enum Type
+    {
+        Null,
+        Bool,
+        Number,
+        String,
+        Array,
+        Object
+    };
+
+    Type type = Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> array;
+    std::vector<std::pair<std::string, JsonValue> > object;
+
+    /*!
+     * \brief Returns the member with the given key or nullptr.
+     */
+    const JsonValue* find(const std::string& key) const;
+
+    double getNumber(const std::string& key, double defaultValue) const;
+    std::string getString(const std::string& key,
+        const std::string& defaultValue) const;
+    bool getBool(const std::string& key, bool defaultValue) const;
+};
+
+/*!
+ * \brief Parses a JSON document.
+ *
+ * \returns \c true, if the whole text was parsed successfully.
+ */
+bool parseJson(const std::string& text, JsonValue& value);
+
+/*!
+ * \brief Serializes a JSON value.
+ */
+std::string toJson(const JsonValue& value);
+
+/*!
+ * \brief Returns the string as quoted JSON string.
+ */
+std::string quoteJson(const std::string& str);
+
+} // namespace vlStandIn
+
+#endif // VL_STAND_IN_JSON_H
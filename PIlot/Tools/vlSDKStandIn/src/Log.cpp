@@ -0,0 +1,337 @@
+// Global functions of vlSDK.h: version, logging and utilities.
+
+#include "Log.h"
+
+#include <vlSDK.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace vlStandIn
+{
+
+namespace
+{
+
+struct LogListener
+{
+    vlCallbackZString fn;
+    void* clientData;
+};
+
+struct LogState
+{
+    std::mutex mutex;
+    std::vector<LogListener> listeners;
+    bool bufferEnabled = false;
+    size_t maxBufferEntries = 1024;
+    std::deque<std::string> buffer;
+    int level = VL_LOG_WARNING;
+};
+
+LogState& getLogState()
+{
+    static LogState state;
+    return state;
+}
+
+void dispatch(const std::vector<LogListener>& listeners,
+    const std::string& message)
+{
+    for (size_t i = 0; i < listeners.size(); ++i)
+    {
+        listeners[i].fn(message.c_str(), listeners[i].clientData);
+    }
+}
+
+std::string getPath(const char* uri)
+{
+    // Only local files are supported
+    std::string path(uri);
+    const std::string filePrefix = "file://";
+    if (path.compare(0, filePrefix.size(), filePrefix) == 0)
+    {
+        path = path.substr(filePrefix.size());
+    }
+    return path;
+}
+
+} // namespace
+
+bool copyString(const std::string& str, char buffer[], unsigned int maxSize)
+{
+    if (buffer == nullptr || str.size() + 1 > maxSize)
+    {
+        return false;
+    }
+    std::memcpy(buffer, str.c_str(), str.size() + 1);
+    return true;
+}
+
+void log(int level, const std::string& message)
+{
+    LogState& state = getLogState();
+    std::vector<LogListener> listeners;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (level > state.level)
+        {
+            return;
+        }
+        if (state.bufferEnabled)
+        {
+            state.buffer.push_back(message);
+            while (state.buffer.size() > state.maxBufferEntries)
+            {
+                state.buffer.pop_front();
+            }
+            return;
+        }
+        std::vector<LogListener>(state.listeners).swap(listeners);
+    }
+    dispatch(listeners, message);
+}
+
+} // namespace vlStandIn
+
+using vlStandIn::getLogState;
+
+extern "C"
+{
+
+unsigned int VL_CALLINGCONVENTION vlGetVersionMajor()
+{
+    return VL_SDK_VERSION_MAJOR;
+}
+
+unsigned int VL_CALLINGCONVENTION vlGetVersionMinor()
+{
+    return VL_SDK_VERSION_MINOR;
+}
+
+unsigned int VL_CALLINGCONVENTION vlGetVersionRevision()
+{
+    return VL_SDK_VERSION_REVISION;
+}
+
+bool VL_CALLINGCONVENTION vlGetVersionString(char version[],
+    unsigned int maxSize)
+{
+    return vlStandIn::copyString(VL_SDK_VERSION_STRING, version, maxSize);
+}
+
+bool VL_CALLINGCONVENTION vlGetVersionHashString(char version[],
+    unsigned int maxSize)
+{
+    return vlStandIn::copyString("stand-in", version, maxSize);
+}
+
+bool VL_CALLINGCONVENTION vlGetVersionTimestampString(char versionTimeStamp[],
+    unsigned int maxSize)
+{
+    return vlStandIn::copyString(__DATE__ " " __TIME__, versionTimeStamp,
+        maxSize);
+}
+
+bool VL_CALLINGCONVENTION vlAddLogListener(vlCallbackZString fn,
+    void* clientData)
+{
+    vlStandIn::LogState& state = getLogState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (size_t i = 0; i < state.listeners.size(); ++i)
+    {
+        if (state.listeners[i].fn == fn &&
+            state.listeners[i].clientData == clientData)
+        {
+            return false;
+        }
+    }
+    vlStandIn::LogListener listener = {fn, clientData};
+    state.listeners.push_back(listener);
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlRemoveLogListener(vlCallbackZString fn,
+    void* clientData)
+{
+    vlStandIn::LogState& state = getLogState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (size_t i = 0; i < state.listeners.size(); ++i)
+    {
+        if (state.listeners[i].fn == fn &&
+            state.listeners[i].clientData == clientData)
+        {
+            state.listeners.erase(state.listeners.begin() + i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool VL_CALLINGCONVENTION vlClearLogListeners()
+{
+    vlStandIn::LogState& state = getLogState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.listeners.clear();
+    return true;
+}
+
+void VL_CALLINGCONVENTION vlEnableLogBuffer()
+{
+    vlStandIn::LogState& state = getLogState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.bufferEnabled = true;
+}
+
+void VL_CALLINGCONVENTION vlDisableLogBuffer()
+{
+    vlStandIn::LogState& state = getLogState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.bufferEnabled = false;
+}
+
+void VL_CALLINGCONVENTION vlSetLogBufferSize(unsigned int maxEntries)
+{
+    vlStandIn::LogState& state = getLogState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.maxBufferEntries = maxEntries;
+}
+
+bool VL_CALLINGCONVENTION vlFlushLogBuffer()
+{
+    vlStandIn::LogState& state = getLogState();
+    std::deque<std::string> buffer;
+    std::vector<vlStandIn::LogListener> listeners;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (!state.bufferEnabled)
+        {
+            return false;
+        }
+        buffer.swap(state.buffer);
+        std::vector<vlStandIn::LogListener>(state.listeners).swap(listeners);
+    }
+    for (size_t i = 0; i < buffer.size(); ++i)
+    {
+        vlStandIn::dispatch(listeners, buffer[i]);
+    }
+    return true;
+}
+
+int VL_CALLINGCONVENTION vlGetLogLevel()
+{
+    vlStandIn::LogState& state = getLogState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.level;
+}
+
+bool VL_CALLINGCONVENTION vlSetLogLevel(int level)
+{
+    if (level < VL_LOG_LOG || level > VL_LOG_DEBUG)
+    {
+        return false;
+    }
+    vlStandIn::LogState& state = getLogState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.level = level;
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlLog(const char message[], int level)
+{
+    if (message == nullptr)
+    {
+        return false;
+    }
+    vlStandIn::log(level, message);
+    return true;
+}
+
+void VL_CALLINGCONVENTION vlSetScreenOrientation(int screenOrientation)
+{
+    // The simulated images don't depend on the screen orientation
+    (void)screenOrientation;
+}
+
+unsigned char* VL_CALLINGCONVENTION vlSDKUtil_get(const char* uri,
+    unsigned long* size, const char* options)
+{
+    (void)options;
+    if (uri == nullptr || size == nullptr)
+    {
+        return nullptr;
+    }
+
+    std::ifstream file(vlStandIn::getPath(uri).c_str(), std::ios::binary);
+    if (!file)
+    {
+        return nullptr;
+    }
+    std::ostringstream stream;
+    stream << file.rdbuf();
+    std::string content = stream.str();
+
+    unsigned char* data = static_cast<unsigned char*>(
+        std::malloc(content.size() > 0 ? content.size() : 1));
+    if (data == nullptr)
+    {
+        return nullptr;
+    }
+    std::memcpy(data, content.data(), content.size());
+    *size = static_cast<unsigned long>(content.size());
+    return data;
+}
+
+bool VL_CALLINGCONVENTION vlSDKUtil_set(const char* uri, const void* data,
+    unsigned long size, const char* options)
+{
+    (void)options;
+    if (uri == nullptr || (data == nullptr && size > 0))
+    {
+        return false;
+    }
+    std::ofstream file(vlStandIn::getPath(uri).c_str(), std::ios::binary);
+    file.write(static_cast<const char*>(data),
+        static_cast<std::streamsize>(size));
+    return static_cast<bool>(file);
+}
+
+bool VL_CALLINGCONVENTION vlSDKUtil_getTempFilename(const char* prefName,
+    char* newName, unsigned int maxSize)
+{
+    static std::mutex mutex;
+    static unsigned int counter = 0;
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ostringstream name;
+    name << "/tmp/" << (prefName != nullptr ? prefName : "vl") << "_"
+        << counter++;
+    return vlStandIn::copyString(name.str(), newName, maxSize);
+}
+
+unsigned char* VL_CALLINGCONVENTION vlSDKUtil_getCameraPositionsFromGeometry(
+    const char* geometryJson, unsigned long* size)
+{
+    // Not simulated
+    (void)geometryJson;
+    (void)size;
+    return nullptr;
+}
+
+unsigned char* VL_CALLINGCONVENTION
+    vlSDKUtil_getCameraTransformsFromWorkspaceDefinition(
+        const char* workspaceJson, unsigned long* size)
+{
+    // Not simulated
+    (void)workspaceJson;
+    (void)size;
+    return nullptr;
+}
+
+} // extern "C"
@@ -0,0 +1,23 @@
+#ifndef VL_STAND_IN_LOG_H
+#define VL_STAND_IN_LOG_H
+
+#include <string>
+
+namespace vlStandIn
+{
+
+/*!
+ * \brief Writes a message to the log listeners of vlSDK.h.
+ */
+void log(int level, const std::string& message);
+
+/*!
+ * \brief Copies a string into a buffer of the caller.
+ *
+ * \returns \c false, if the buffer is too small.
+ */
+bool copyString(const std::string& str, char buffer[], unsigned int maxSize);
+
+} // namespace vlStandIn
+
+#endif // VL_STAND_IN_LOG_H
@@ -0,0 +1,649 @@
+#include "Simulator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#include <time.h>
+#endif
+
+unsigned int vlImageWrapper_s::getBytesPerPixel() const
+{
+    switch (this->format)
+    {
+        case VL_IMAGE_FORMAT_GREY:
+            return 1;
+        case VL_IMAGE_FORMAT_RGB:
+            return 3;
+        case VL_IMAGE_FORMAT_RGBA:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+namespace vlStandIn
+{
+
+namespace
+{
+
+// Number of frames after a reset, which are reported as lost while the
+// tracker "initializes"
+const long long initFrames = 3;
+
+const double pi = 3.14159265358979323846;
+
+// Distance between the objects in meters
+const double objectSpacing = 0.1;
+
+// Number of model edges of the line search of each object. Every edge
+// costs the same CPU time.
+const size_t modelEdgeCount = 64;
+
+// The line search runs on the second level of a pyramid with three levels
+const unsigned int pyramidLevelCount = 3;
+const unsigned int searchLevel = 1;
+
+// Radius of the circular model outline in meters and length of the search
+// line on each side of the projected edge in pixels of the search level
+const double modelRadius = 0.03;
+const int searchRange = 8;
+
+// Minimum absolute Laplace response of an edge pixel like the
+// laplaceThreshold parameter of the VisionLib
+const int laplaceThreshold = 8;
+
+// Number of image rows, which are generated at once
+const size_t rowsPerRange = 16;
+
+// Returns the CPU time of the calling thread in milliseconds. Unlike the
+// wall time it doesn't advance while the thread waits for a core.
+double getThreadCpuTime()
+{
+#ifdef __linux__
+    timespec time;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return time.tv_sec * 1000.0 + time.tv_nsec / 1000000.0;
+#else
+    return getTime() * 1000.0;
+#endif
+}
+
+void spin(double milliseconds)
+{
+    double end = getThreadCpuTime() + milliseconds;
+    while (getThreadCpuTime() < end)
+    {
+    }
+}
+
+// Rotates a vector by a quaternion (x, y, z, w)
+void rotate(const float q[4], const float v[3], float result[3])
+{
+    // result = v + 2 * w * (u x v) + 2 * u x (u x v)
+    float c[3] = {q[1] * v[2] - q[2] * v[1], q[2] * v[0] - q[0] * v[2],
+        q[0] * v[1] - q[1] * v[0]};
+    float cc[3] = {q[1] * c[2] - q[2] * c[1], q[2] * c[0] - q[0] * c[2],
+        q[0] * c[1] - q[1] * c[0]};
+    for (int i = 0; i < 3; ++i)
+    {
+        result[i] = v[i] + 2.0f * (q[3] * c[i] + cc[i]);
+    }
+}
+
+// Outline of an object on the search level
+struct Outline
+{
+    double x;
+    double y;
+    double radius;
+};
+
+// Searches an edge with the strongest gradient along the normal of a model
+// edge. The model edge lies on the outline at the given angle.
+bool searchEdge(const ImagePyramid::Level& level, const Outline& outline,
+    double angle)
+{
+    double dx = std::cos(angle);
+    double dy = std::sin(angle);
+    int strongest = 0;
+    for (int step = -searchRange; step <= searchRange; ++step)
+    {
+        double distance = outline.radius + step;
+        long x = std::lround(outline.x + distance * dx);
+        long y = std::lround(outline.y + distance * dy);
+        if (x < 0 || y < 0 || x >= static_cast<long>(level.width) ||
+            y >= static_cast<long>(level.height))
+        {
+            continue;
+        }
+        size_t offset = static_cast<size_t>(y) * level.stride +
+            static_cast<size_t>(x);
+        if (std::abs(level.laplace[offset]) >= laplaceThreshold)
+        {
+            strongest = std::max(strongest,
+                static_cast<int>(level.gradient[offset]));
+        }
+    }
+    return strongest > 0;
+}
+
+// Line search over the model edges of all objects. The objects read the
+// shared pyramid of the frame, so every object only adds its own edges,
+// which cost processingTime in total. The edges of all objects are
+// distributed over the threads of the pool.
+void searchEdges(Frame& frame, double processingTime, WorkStealingPool& pool)
+{
+    const ImagePyramid& pyramid = frame.pyramid;
+    size_t objectCount = frame.objects.size();
+    if (objectCount == 0)
+    {
+        return;
+    }
+
+    // Projection of the object origins with the intrinsics
+    const ImagePyramid::Level* level = nullptr;
+    std::vector<Outline> outlines(objectCount);
+    if (pyramid.getLevelCount() > 0)
+    {
+        level = &pyramid.getLevel(
+            std::min<size_t>(searchLevel, pyramid.getLevelCount() - 1));
+        const vlIntrinsicDataWrapper_s& intrinsics = frame.intrinsicData;
+        for (size_t i = 0; i < objectCount; ++i)
+        {
+            const float* t = frame.objects[i].extrinsicData.t;
+            double z = std::max(static_cast<double>(t[2]), 0.01);
+            outlines[i].x = (intrinsics.fxNorm * t[0] / z +
+                intrinsics.cxNorm) * level->width;
+            outlines[i].y = (intrinsics.fyNorm * t[1] / z +
+                intrinsics.cyNorm) * level->height;
+            outlines[i].radius =
+                intrinsics.fxNorm * level->width * modelRadius / z;
+        }
+    }
+
+    std::vector<std::atomic<unsigned int> > correspondences(objectCount);
+    for (size_t i = 0; i < objectCount; ++i)
+    {
+        correspondences[i].store(0);
+    }
+    double edgeTime = processingTime / modelEdgeCount;
+    pool.parallelFor(objectCount * modelEdgeCount, 1,
+        [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            size_t object = i / modelEdgeCount;
+            double angle = 2.0 * pi * (i % modelEdgeCount) / modelEdgeCount;
+            if (level != nullptr &&
+                searchEdge(*level, outlines[object], angle))
+            {
+                correspondences[object].fetch_add(1,
+                    std::memory_order_relaxed);
+            }
+        }
+        if (edgeTime > 0.0)
+        {
+            spin(edgeTime * (end - begin));
+        }
+    });
+
+    for (size_t i = 0; i < objectCount; ++i)
+    {
+        frame.objects[i].correspondences = correspondences[i].load();
+    }
+}
+
+bool readFile(const std::string& path, std::string& content)
+{
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    std::ostringstream stream;
+    stream << file.rdbuf();
+    content = stream.str();
+    return true;
+}
+
+const char* getEnvironment(const char* name)
+{
+    const char* value = std::getenv(name);
+    return (value != nullptr && value[0] != '\0') ? value : nullptr;
+}
+
+} // namespace
+
+double getTime()
+{
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double getSystemTime()
+{
+    return std::chrono::duration<double>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+void SimulatorConfig::applyEnvironment()
+{
+    const char* value;
+    if ((value = getEnvironment("VL_STAND_IN_FPS")) != nullptr)
+    {
+        this->fps = std::atof(value);
+    }
+    if ((value = getEnvironment("VL_STAND_IN_WIDTH")) != nullptr)
+    {
+        this->width = static_cast<unsigned int>(std::atoi(value));
+    }
+    if ((value = getEnvironment("VL_STAND_IN_HEIGHT")) != nullptr)
+    {
+        this->height = static_cast<unsigned int>(std::atoi(value));
+    }
+    if ((value = getEnvironment("VL_STAND_IN_GROUND_TRUTH")) != nullptr)
+    {
+        this->groundTruth = value;
+    }
+    if ((value = getEnvironment("VL_STAND_IN_LOOP")) != nullptr)
+    {
+        this->loop = (std::atoi(value) != 0);
+    }
+    if ((value = getEnvironment("VL_STAND_IN_LOST_FRACTION")) != nullptr)
+    {
+        this->lostFraction = std::atof(value);
+    }
+    if ((value = getEnvironment("VL_STAND_IN_PROCESSING_TIME")) != nullptr)
+    {
+        this->processingTime = std::atof(value);
+    }
+    if ((value = getEnvironment("VL_STAND_IN_PREPROCESSING_TIME")) != nullptr)
+    {
+        this->preprocessingTime = std::atof(value);
+    }
+    if ((value = getEnvironment("VL_STAND_IN_MAX_QUEUED_FRAMES")) != nullptr)
+    {
+        this->maxQueuedFrames = static_cast<unsigned int>(std::atoi(value));
+    }
+    if ((value = getEnvironment("VL_STAND_IN_OBJECTS")) != nullptr)
+    {
+        // Comma separated list of names
+        this->objectNames.clear();
+        std::istringstream names(value);
+        std::string name;
+        while (std::getline(names, name, ','))
+        {
+            if (!name.empty())
+            {
+                this->objectNames.push_back(name);
+            }
+        }
+    }
+}
+
+void SimulatorConfig::applyJson(const JsonValue& standIn)
+{
+    this->fps = standIn.getNumber("fps", this->fps);
+    this->width = static_cast<unsigned int>(
+        standIn.getNumber("width", this->width));
+    this->height = static_cast<unsigned int>(
+        standIn.getNumber("height", this->height));
+    this->groundTruth = standIn.getString("groundTruth", this->groundTruth);
+    this->loop = standIn.getBool("loop", this->loop);
+    this->lostFraction = standIn.getNumber("lostFraction", this->lostFraction);
+    this->lostPeriod = static_cast<unsigned int>(
+        standIn.getNumber("lostPeriod", this->lostPeriod));
+    this->processingTime =
+        standIn.getNumber("processingTime", this->processingTime);
+    this->preprocessingTime =
+        standIn.getNumber("preprocessingTime", this->preprocessingTime);
+    this->maxQueuedFrames = static_cast<unsigned int>(
+        standIn.getNumber("maxQueuedFrames", this->maxQueuedFrames));
+    const JsonValue* objects = standIn.find("objects");
+    if (objects != nullptr && objects->type == JsonValue::Array)
+    {
+        this->objectNames.clear();
+        for (size_t i = 0; i < objects->array.size(); ++i)
+        {
+            if (objects->array[i].type == JsonValue::String)
+            {
+                this->objectNames.push_back(objects->array[i].string);
+            }
+        }
+    }
+}
+
+bool Simulator::load(const SimulatorConfig& config, std::string& error)
+{
+    this->config = config;
+    if (this->config.objectNames.empty())
+    {
+        this->config.objectNames.push_back("TrackedObject");
+    }
+    this->poses.clear();
+    this->frameCount = 0;
+    this->trackCount = 0;
+    this->resetFrame = 0;
+
+    // Default intrinsics with a horizontal field of view of 60 degrees
+    this->intrinsics = vlIntrinsicDataWrapper_s();
+    this->intrinsics.width = config.width;
+    this->intrinsics.height = config.height;
+    this->intrinsics.fxNorm = 0.5 / std::tan(pi / 6.0);
+    this->intrinsics.fyNorm = this->intrinsics.fxNorm * config.width /
+        std::max(1u, config.height);
+    this->intrinsics.calibrated = true;
+
+    if (config.groundTruth.empty())
+    {
+        return true;
+    }
+
+    std::string content;
+    JsonValue groundTruth;
+    if (!readFile(config.groundTruth, content))
+    {
+        error = "Failed to read '" + config.groundTruth + "'";
+        return false;
+    }
+    if (!parseJson(content, groundTruth))
+    {
+        error = "Failed to parse '" + config.groundTruth + "'";
+        return false;
+    }
+
+    const JsonValue* intrinsics = groundTruth.find("intrinsics");
+    if (intrinsics != nullptr)
+    {
+        this->intrinsics.width = static_cast<unsigned int>(
+            intrinsics->getNumber("width", config.width));
+        this->intrinsics.height = static_cast<unsigned int>(
+            intrinsics->getNumber("height", config.height));
+        this->intrinsics.fxNorm =
+            intrinsics->getNumber("fxNorm", this->intrinsics.fxNorm);
+        this->intrinsics.fyNorm =
+            intrinsics->getNumber("fyNorm", this->intrinsics.fyNorm);
+        this->intrinsics.cxNorm = intrinsics->getNumber("cxNorm", 0.5);
+        this->intrinsics.cyNorm = intrinsics->getNumber("cyNorm", 0.5);
+        this->config.width = this->intrinsics.width;
+        this->config.height = this->intrinsics.height;
+    }
+
+    // Image names are relative to the directory of the ground truth
+    std::string directory;
+    size_t separator = config.groundTruth.find_last_of("/\\");
+    if (separator != std::string::npos)
+    {
+        directory = config.groundTruth.substr(0, separator + 1);
+    }
+
+    const JsonValue* poses = groundTruth.find("poses");
+    if (poses == nullptr || poses->type != JsonValue::Array)
+    {
+        error = "'" + config.groundTruth + "' doesn't contain poses";
+        return false;
+    }
+    for (size_t i = 0; i < poses->array.size(); ++i)
+    {
+        const JsonValue& value = poses->array[i];
+        const JsonValue* t = value.find("t");
+        const JsonValue* q = value.find("q");
+        if (t == nullptr || q == nullptr || t->array.size() != 3 ||
+            q->array.size() != 4)
+        {
+            error = "Invalid pose in '" + config.groundTruth + "'";
+            return false;
+        }
+        Pose pose;
+        for (int j = 0; j < 3; ++j)
+        {
+            pose.t[j] = static_cast<float>(t->array[j].number);
+        }
+        for (int j = 0; j < 4; ++j)
+        {
+            pose.q[j] = static_cast<float>(q->array[j].number);
+        }
+        std::string image = value.getString("image", "");
+        if (!image.empty())
+        {
+            pose.image = directory + image;
+        }
+        this->poses.push_back(pose);
+    }
+
+    return true;
+}
+
+const SimulatorConfig& Simulator::getConfig() const
+{
+    return this->config;
+}
+
+void Simulator::setFps(double fps)
+{
+    this->config.fps = fps;
+}
+
+bool Simulator::hasNext() const
+{
+    return this->config.loop || this->poses.empty() ||
+        this->frameCount < static_cast<long long>(this->poses.size());
+}
+
+void Simulator::reset()
+{
+    this->resetFrame = this->trackCount;
+}
+
+std::shared_ptr<Frame> Simulator::acquire(WorkStealingPool& pool)
+{
+    std::shared_ptr<Frame> frame = std::make_shared<Frame>();
+    long long index = this->frameCount++;
+    frame->index = index;
+    frame->timestamp = getTime();
+    frame->captureTime = getSystemTime();
+
+    // Pose and image
+    if (this->poses.empty())
+    {
+        // Orbit around the origin with one degree per frame
+        double angle = (index % 360) * pi / 180.0;
+        frame->extrinsicData.t[2] = 0.5f;
+        frame->extrinsicData.q[1] = static_cast<float>(std::sin(0.5 * angle));
+        frame->extrinsicData.q[3] = static_cast<float>(std::cos(0.5 * angle));
+        generateImage(index, frame->image, pool);
+    }
+    else
+    {
+        const Pose& pose = this->poses[index % this->poses.size()];
+        std::memcpy(frame->extrinsicData.t, pose.t, sizeof(pose.t));
+        std::memcpy(frame->extrinsicData.q, pose.q, sizeof(pose.q));
+        if (!loadPpm(pose.image, frame->image))
+        {
+            generateImage(index, frame->image, pool);
+        }
+    }
+    frame->intrinsicData = this->intrinsics;
+
+    // The pyramid is computed once and shared by the line search of all
+    // objects
+    frame->pyramid.compute(frame->image.pixels.data(), frame->image.width,
+        frame->image.height, frame->image.getBytesPerPixel(),
+        pyramidLevelCount, pool);
+
+    // Simulated preprocessing, e.g. the undistortion. The rows are
+    // processed in parallel.
+    if (this->config.preprocessingTime > 0.0)
+    {
+        double rowTime = this->config.preprocessingTime /
+            std::max(1u, frame->image.height);
+        pool.parallelFor(frame->image.height, rowsPerRange,
+            [rowTime](size_t begin, size_t end)
+        {
+            spin(rowTime * (end - begin));
+        });
+    }
+
+    frame->acquisitionTime = (getTime() - frame->timestamp) * 1000.0;
+    return frame;
+}
+
+void Simulator::track(Frame& frame, double processingTime,
+    WorkStealingPool& pool)
+{
+    double start = getTime();
+    long long index = frame.index;
+    this->trackCount = index + 1;
+
+    // Poses of all objects. The objects are placed next to each other along
+    // the x axis.
+    const std::vector<std::string>& names = this->config.objectNames;
+    frame.objects.resize(names.size());
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        ObjectResult& object = frame.objects[i];
+        object.name = names[i];
+        object.extrinsicData = frame.extrinsicData;
+        float offset[3] = {static_cast<float>(objectSpacing *
+            (i - 0.5 * (names.size() - 1))), 0.0f, 0.0f};
+        float rotatedOffset[3];
+        rotate(object.extrinsicData.q, offset, rotatedOffset);
+        for (int j = 0; j < 3; ++j)
+        {
+            object.extrinsicData.t[j] += rotatedOffset[j];
+        }
+    }
+
+    searchEdges(frame, processingTime, pool);
+
+    // Tracking states of all objects. The objects get recognized one after
+    // another.
+    std::string trackingState = "{\"objects\":[";
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        ObjectResult& object = frame.objects[i];
+        long long objectIndex = index + static_cast<long long>(i) *
+            this->config.lostPeriod / static_cast<long long>(names.size());
+        bool lost = (index - this->resetFrame <
+            initFrames * static_cast<long long>(i + 1));
+        if (this->config.lostFraction > 0.0 && this->config.lostPeriod > 0)
+        {
+            long long phase = objectIndex % this->config.lostPeriod;
+            lost = lost || (phase >= static_cast<long long>(
+                this->config.lostPeriod * (1.0 - this->config.lostFraction)));
+        }
+        object.extrinsicData.valid = !lost;
+
+        double quality = lost ? 0.0 : 0.85 + 0.1 * std::sin(0.1 * objectIndex);
+        char buffer[512];
+        std::snprintf(buffer, sizeof(buffer),
+            "%s{\"name\":%s,\"state\":\"%s\",\"quality\":%.4f,"
+            "\"_InitInlierRatio\":%.4f,\"_InitNumOfCorresp\":%d,"
+            "\"_TrackingInlierRatio\":%.4f,\"_TrackingNumOfCorresp\":%d,"
+            "\"_NumberOfTemplates\":%d,\"_NumberOfTemplatesDynamic\":0,"
+            "\"_NumberOfTemplatesStatic\":%d,\"_NumberOfLineModels\":1,"
+            "\"_TrackingImageWidth\":%u,\"_TrackingImageHeight\":%u,"
+            "\"timeStamp\":%.6f}",
+            i > 0 ? "," : "", quoteJson(object.name).c_str(),
+            lost ? "lost" : "tracked", quality, quality, lost ? 0 : 120,
+            quality, lost ? 0 : static_cast<int>(object.correspondences),
+            16, 16, frame.image.width, frame.image.height,
+            frame.captureTime);
+        trackingState += buffer;
+    }
+    trackingState += "]}";
+    frame.trackingState = trackingState;
+    if (!frame.objects.empty())
+    {
+        frame.extrinsicData = frame.objects[0].extrinsicData;
+    }
+
+    // The latency includes the time the frame waited between the stages
+    double end = getTime();
+    frame.trackingTime = (end - start) * 1000.0;
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+        "{\"processingTime\":%d,\"acquisitionTime\":%.3f,"
+        "\"trackingTime\":%.3f,\"pipelineLatency\":%.3f}",
+        static_cast<int>(std::lround(frame.acquisitionTime +
+            frame.trackingTime)),
+        frame.acquisitionTime, frame.trackingTime,
+        (end - frame.timestamp) * 1000.0);
+    frame.performanceInfo = buffer;
+}
+
+void Simulator::generateImage(long long index, vlImageWrapper_s& image,
+    WorkStealingPool& pool) const
+{
+    // Moving test pattern with a bright square, which orbits the center
+    image.format = VL_IMAGE_FORMAT_RGB;
+    image.width = this->config.width;
+    image.height = this->config.height;
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height * 3);
+
+    unsigned int shift = static_cast<unsigned int>(index);
+    double angle = (index % 360) * pi / 180.0;
+    int size = static_cast<int>(image.height / 8);
+    int squareX = static_cast<int>(image.width * (0.5 + 0.3 * std::cos(angle)));
+    int squareY = static_cast<int>(image.height * (0.5 + 0.3 * std::sin(angle)));
+    int width = static_cast<int>(image.width);
+    unsigned char* pixels = image.pixels.data();
+    pool.parallelFor(image.height, rowsPerRange, [=](size_t begin, size_t end)
+    {
+        unsigned char* pixel = pixels + begin * width * 3;
+        for (int y = static_cast<int>(begin); y < static_cast<int>(end); ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                bool square = std::abs(x - squareX) < size &&
+                    std::abs(y - squareY) < size;
+                pixel[0] = square ? 255 :
+                    static_cast<unsigned char>(x + 4 * shift);
+                pixel[1] = square ? 255 :
+                    static_cast<unsigned char>(y + 2 * shift);
+                pixel[2] = square ? 255 :
+                    static_cast<unsigned char>((x ^ y) & 0x40);
+                pixel += 3;
+            }
+        }
+    });
+}
+
+bool Simulator::loadPpm(const std::string& path, vlImageWrapper_s& image) const
+{
+    if (path.size() < 4 || path.compare(path.size() - 4, 4, ".ppm") != 0)
+    {
+        return false;
+    }
+
+    std::ifstream file(path.c_str(), std::ios::binary);
+    std::string magic;
+    unsigned int width = 0;
+    unsigned int height = 0;
+    unsigned int maxValue = 0;
+    file >> magic >> width >> height >> maxValue;
+    if (!file || magic != "P6" || maxValue != 255)
+    {
+        return false;
+    }
+    // Skip the single whitespace after the header
+    file.get();
+
+    image.format = VL_IMAGE_FORMAT_RGB;
+    image.width = width;
+    image.height = height;
+    image.pixels.resize(static_cast<size_t>(width) * height * 3);
+    file.read(reinterpret_cast<char*>(image.pixels.data()),
+        static_cast<std::streamsize>(image.pixels.size()));
+    return static_cast<bool>(file);
+}
+
+} // namespace vlStandIn
@@ -0,0 +1,226 @@
+#ifndef VL_STAND_IN_SIMULATOR_H
+#define VL_STAND_IN_SIMULATOR_H
+
+#include "ImagePyramid.h"
+#include "Json.h"
+#include "ThreadPool.h"
+
+#include <vlSDK.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+// The opaque types of vlSDK.h are defined here, because the simulator
+// creates their contents.
+
+struct vlImageWrapper_s
+{
+    vlImageFormat format = VL_IMAGE_FORMAT_UNDEFINED;
+    unsigned int width = 0;
+    unsigned int height = 0;
+    std::vector<unsigned char> pixels;
+
+    unsigned int getBytesPerPixel() const;
+};
+
+struct vlExtrinsicDataWrapper_s
+{
+    bool valid = false;
+    float t[3] = {0.0f, 0.0f, 0.0f};
+    float q[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+};
+
+struct vlIntrinsicDataWrapper_s
+{
+    unsigned int width = 0;
+    unsigned int height = 0;
+    double fxNorm = 0.0;
+    double fyNorm = 0.0;
+    double skewNorm = 0.0;
+    double cxNorm = 0.5;
+    double cyNorm = 0.5;
+    bool calibrated = false;
+    double calibrationError = 0.0;
+    double k[5] = {0.0, 0.0, 0.0, 0.0, 0.0};
+};
+
+namespace vlStandIn
+{
+
+/*!
+ * \brief Settings of the simulator.
+ *
+ * The settings are read from the \c VL_STAND_IN_* environment variables and
+ * from the optional \c "standIn" section of the tracking configuration.
+ */
+struct SimulatorConfig
+{
+    /*! Frames per second of the asynchronous worker. */
+    double fps = 30.0;
+    /*! Size of the generated images. */
+    unsigned int width = 640;
+    unsigned int height = 480;
+    /*!
+     * groundTruth.json written by the VLSyntheticSequenceGenerator. The
+     * poses are replayed and PPM images next to the file are loaded.
+     */
+    std::string groundTruth;
+    /*! Whether the sequence restarts after the last frame. */
+    bool loop = true;
+    /*!
+     * Fraction of each block of \c lostPeriod frames, which is reported as
+     * lost.
+     */
+    double lostFraction = 0.0;
+    unsigned int lostPeriod = 100;
+    /*!
+     * Simulated CPU time per frame and object in milliseconds, which a
+     * single thread needs for the line search over the model edges of the
+     * object. The edges of all objects are distributed over the threads of
+     * the worker.
+     */
+    double processingTime = 0.0;
+    /*!
+     * Simulated CPU time per frame in milliseconds for preprocessing the
+     * camera image in addition to the image pyramid, e.g. the undistortion.
+     * It doesn't depend on the number of objects.
+     */
+    double preprocessingTime = 0.0;
+    /*! Maximum number of frames waiting for vlWorker_PollEvents. */
+    unsigned int maxQueuedFrames = 8;
+    /*!
+     * Names of the tracked objects. Each object is reported in the
+     * tracking states and through the named extrinsic data with its name.
+     * The objects are placed next to each other and get recognized one
+     * after another.
+     */
+    std::vector<std::string> objectNames = {"TrackedObject"};
+
+    void applyEnvironment();
+    void applyJson(const JsonValue& standIn);
+};
+
+/*!
+ * \brief Pose of one tracked object.
+ */
+struct ObjectResult
+{
+    std::string name;
+    vlExtrinsicDataWrapper_s extrinsicData;
+    /*! Number of model edges, for which the line search found an edge. */
+    unsigned int correspondences = 0;
+};
+
+/*!
+ * \brief All events produced for one frame.
+ *
+ * \c extrinsicData is the pose of the first object.
+ */
+struct Frame
+{
+    long long index = 0;
+    double timestamp = 0.0;
+    /*!
+     * Capture time in seconds since 1.1.1970 like the \c timeStamp of the
+     * tracking states of the VisionLib.
+     */
+    double captureTime = 0.0;
+    vlImageWrapper_s image;
+    /*! Preprocessed image, which the line search of all objects reads. */
+    ImagePyramid pyramid;
+    vlExtrinsicDataWrapper_s extrinsicData;
+    vlIntrinsicDataWrapper_s intrinsicData;
+    std::vector<ObjectResult> objects;
+    std::string trackingState;
+    std::string performanceInfo;
+    /*! Durations of the acquisition and the tracking in milliseconds. */
+    double acquisitionTime = 0.0;
+    double trackingTime = 0.0;
+};
+
+/*!
+ * \brief Deterministic source of frames.
+ *
+ * Without ground truth the camera orbits around the origin and a moving
+ * test pattern is generated. The content of a frame only depends on its
+ * index.
+ */
+class Simulator
+{
+public:
+    /*!
+     * \brief Applies the settings and loads the ground truth.
+     */
+    bool load(const SimulatorConfig& config, std::string& error);
+
+    const SimulatorConfig& getConfig() const;
+    void setFps(double fps);
+
+    /*!
+     * \brief Returns \c false, if the sequence ended and looping is
+     * disabled.
+     */
+    bool hasNext() const;
+
+    /*!
+     * \brief Acquires and preprocesses the image of the next frame.
+     *
+     * The result contains the image, its pyramid, the intrinsics and the
+     * camera pose.
+     * acquire may run concurrently with track, but not with the other
+     * functions.
+     */
+    std::shared_ptr<Frame> acquire(WorkStealingPool& pool);
+
+    /*!
+     * \brief Estimates the poses of the objects in an acquired frame.
+     *
+     * The line search of every object reads the shared pyramid of the
+     * frame. The frames must be tracked in the order of their acquisition.
+     */
+    void track(Frame& frame, double processingTime, WorkStealingPool& pool);
+
+    /*!
+     * \brief Restarts the tracking state, e.g. after a reset command.
+     *
+     * The reset applies to the next tracked frame.
+     */
+    void reset();
+
+private:
+    struct Pose
+    {
+        float t[3];
+        float q[4];
+        std::string image;
+    };
+
+    SimulatorConfig config;
+    std::vector<Pose> poses;
+    vlIntrinsicDataWrapper_s intrinsics;
+    // Written by acquire and read by hasNext
+    std::atomic<long long> frameCount{0};
+    // Index of the next tracked frame and of the first frame after a reset
+    long long trackCount = 0;
+    long long resetFrame = 0;
+
+    void generateImage(long long index, vlImageWrapper_s& image,
+        WorkStealingPool& pool) const;
+    bool loadPpm(const std::string& path, vlImageWrapper_s& image) const;
+};
+
+/*!
+ * \brief Returns the time of a monotonic clock in seconds.
+ */
+double getTime();
+
+/*!
+ * \brief Returns the wall clock time in seconds since 1.1.1970.
+ */
+double getSystemTime();
+
+} // namespace vlStandIn
+
+#endif // VL_STAND_IN_SIMULATOR_H
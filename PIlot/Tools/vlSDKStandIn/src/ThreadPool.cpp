@@ -0,0 +1,368 @@
+#include "ThreadPool.h"
+
+#include "Log.h"
+
+#include <vlSDK.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace vlStandIn
+{
+
+namespace
+{
+
+// Nice value of the threads with a low or high priority
+const int priorityNiceValue = 10;
+
+const char* getEnvironment(const char* name)
+{
+    const char* value = std::getenv(name);
+    return (value != nullptr && value[0] != '\0') ? value : nullptr;
+}
+
+// Accepts decimal and hexadecimal ("0xff") masks
+bool parseMask(const std::string& str, unsigned long long& mask)
+{
+    if (str.empty())
+    {
+        return false;
+    }
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long value = std::strtoull(str.c_str(), &end, 0);
+    if (errno != 0 || end == nullptr || *end != '\0')
+    {
+        return false;
+    }
+    mask = value;
+    return true;
+}
+
+unsigned int countBits(unsigned long long mask)
+{
+    unsigned int count = 0;
+    for (; mask != 0; mask &= mask - 1)
+    {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+void WorkerOptions::applyEnvironment()
+{
+    const char* value;
+    if ((value = getEnvironment("VL_STAND_IN_THREADS")) != nullptr)
+    {
+        this->threadCount = static_cast<unsigned int>(std::atoi(value));
+    }
+    if ((value = getEnvironment("VL_STAND_IN_AFFINITY")) != nullptr)
+    {
+        if (!parseMask(value, this->affinityMask))
+        {
+            log(VL_LOG_WARNING,
+                "[vlSDKStandIn] Invalid VL_STAND_IN_AFFINITY");
+        }
+    }
+    if ((value = getEnvironment("VL_STAND_IN_PRIORITY")) != nullptr)
+    {
+        this->priority = std::max(-1, std::min(1, std::atoi(value)));
+    }
+    if ((value = getEnvironment("VL_STAND_IN_PIPELINED")) != nullptr)
+    {
+        this->pipelined = (std::atoi(value) != 0);
+    }
+    if ((value = getEnvironment("VL_STAND_IN_PIPELINE_DEPTH")) != nullptr)
+    {
+        this->pipelineDepth = static_cast<unsigned int>(
+            std::max(1, std::atoi(value)));
+    }
+}
+
+bool WorkerOptions::applyJson(const JsonValue& options, std::string& error)
+{
+    if (options.type != JsonValue::Object)
+    {
+        error = "The worker options must be an object";
+        return false;
+    }
+
+    double threadCount = options.getNumber("threadCount", this->threadCount);
+    if (threadCount < 0.0)
+    {
+        error = "threadCount must not be negative";
+        return false;
+    }
+    this->threadCount = static_cast<unsigned int>(threadCount);
+
+    // Masks with more than 53 bits can only be passed as string
+    const JsonValue* affinityMask = options.find("affinityMask");
+    if (affinityMask != nullptr)
+    {
+        if (affinityMask->type == JsonValue::Number &&
+            affinityMask->number >= 0.0)
+        {
+            this->affinityMask =
+                static_cast<unsigned long long>(affinityMask->number);
+        }
+        else if (affinityMask->type != JsonValue::String ||
+            !(affinityMask->string.empty() ||
+                parseMask(affinityMask->string, this->affinityMask)))
+        {
+            error = "affinityMask must be a number or a string like \"0xff\"";
+            return false;
+        }
+    }
+
+    double priority = options.getNumber("priority", this->priority);
+    if (priority < -1.0 || priority > 1.0)
+    {
+        error = "priority must be -1, 0 or 1";
+        return false;
+    }
+    this->priority = static_cast<int>(priority);
+
+    this->pipelined = options.getBool("pipelined", this->pipelined);
+    double pipelineDepth =
+        options.getNumber("pipelineDepth", this->pipelineDepth);
+    if (pipelineDepth < 1.0)
+    {
+        error = "pipelineDepth must be at least 1";
+        return false;
+    }
+    this->pipelineDepth = static_cast<unsigned int>(pipelineDepth);
+    return true;
+}
+
+unsigned int WorkerOptions::getThreadCount() const
+{
+    if (this->threadCount > 0)
+    {
+        return this->threadCount;
+    }
+    // All cores, which the threads may run on
+    unsigned int cores = this->affinityMask != 0 ?
+        countBits(this->affinityMask) : std::thread::hardware_concurrency();
+    return std::max(1u, cores);
+}
+
+void applyToCurrentThread(const WorkerOptions& options)
+{
+#ifdef __linux__
+    if (options.affinityMask != 0)
+    {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (unsigned int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu)
+        {
+            if ((options.affinityMask >> cpu) & 1ull)
+            {
+                CPU_SET(cpu, &cpus);
+            }
+        }
+        int result = pthread_setaffinity_np(pthread_self(), sizeof(cpus),
+            &cpus);
+        if (result != 0)
+        {
+            log(VL_LOG_WARNING,
+                std::string("[vlSDKStandIn] Failed to set the affinity: ") +
+                std::strerror(result));
+        }
+    }
+    if (options.priority != 0)
+    {
+        // On Linux the nice value belongs to the thread and not to the
+        // process. Raising the priority requires CAP_SYS_NICE.
+        int nice = options.priority > 0 ?
+            -priorityNiceValue : priorityNiceValue;
+        if (setpriority(PRIO_PROCESS,
+            static_cast<id_t>(syscall(SYS_gettid)), nice) != 0)
+        {
+            log(VL_LOG_WARNING,
+                std::string("[vlSDKStandIn] Failed to set the priority: ") +
+                std::strerror(errno));
+        }
+    }
+#else
+    if (options.affinityMask != 0 || options.priority != 0)
+    {
+        log(VL_LOG_WARNING,
+            "[vlSDKStandIn] The affinity and the priority are only "
+            "supported on Linux");
+    }
+#endif
+}
+
+WorkStealingPool::WorkStealingPool(const WorkerOptions& options)
+{
+    unsigned int threadCount = options.getThreadCount();
+    for (unsigned int i = 0; i < threadCount; ++i)
+    {
+        this->queues.push_back(std::unique_ptr<Queue>(new Queue()));
+    }
+    for (unsigned int i = 1; i < threadCount; ++i)
+    {
+        this->threads.push_back(
+            std::thread(&WorkStealingPool::run, this, i, options));
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopRequested = true;
+    }
+    this->condition.notify_all();
+    for (size_t i = 0; i < this->threads.size(); ++i)
+    {
+        this->threads[i].join();
+    }
+}
+
+unsigned int WorkStealingPool::getThreadCount() const
+{
+    return static_cast<unsigned int>(this->queues.size());
+}
+
+void WorkStealingPool::parallelFor(size_t count, size_t grainSize,
+    const RangeFunction& fn)
+{
+    grainSize = std::max<size_t>(1, grainSize);
+    size_t rangeCount = (count + grainSize - 1) / grainSize;
+    if (this->threads.empty() || rangeCount <= 1)
+    {
+        for (size_t begin = 0; begin < count; begin += grainSize)
+        {
+            fn(begin, std::min(count, begin + grainSize));
+        }
+        return;
+    }
+
+    Batch batch;
+    batch.fn = &fn;
+    batch.remaining = rangeCount;
+
+    // Neighbouring ranges go to the same queue, so the owner of a queue
+    // works on contiguous memory until it has to steal
+    size_t queueCount = this->queues.size();
+    for (size_t q = 0; q < queueCount; ++q)
+    {
+        size_t first = rangeCount * q / queueCount;
+        size_t last = rangeCount * (q + 1) / queueCount;
+        std::lock_guard<std::mutex> lock(this->queues[q]->mutex);
+        // The owner takes ranges from the back
+        for (size_t r = last; r > first; --r)
+        {
+            Range range = {&batch, (r - 1) * grainSize,
+                std::min(count, r * grainSize)};
+            this->queues[q]->ranges.push_back(range);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->queuedRanges += static_cast<long long>(rangeCount);
+    }
+    this->condition.notify_all();
+
+    // Help until all ranges were processed
+    for (;;)
+    {
+        Range range;
+        if (this->take(0, range))
+        {
+            this->execute(range);
+            continue;
+        }
+        // The remaining ranges are processed by other threads
+        std::unique_lock<std::mutex> lock(batch.mutex);
+        batch.condition.wait(lock, [&batch]()
+        {
+            return batch.remaining == 0;
+        });
+        return;
+    }
+}
+
+bool WorkStealingPool::take(size_t queueIndex, Range& range)
+{
+    size_t queueCount = this->queues.size();
+    bool found = false;
+    {
+        Queue& own = *this->queues[queueIndex];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.ranges.empty())
+        {
+            range = own.ranges.back();
+            own.ranges.pop_back();
+            found = true;
+        }
+    }
+    // Steal the oldest range of another queue
+    for (size_t i = 1; !found && i < queueCount; ++i)
+    {
+        Queue& other = *this->queues[(queueIndex + i) % queueCount];
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if (!other.ranges.empty())
+        {
+            range = other.ranges.front();
+            other.ranges.pop_front();
+            found = true;
+        }
+    }
+    if (found)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        --this->queuedRanges;
+    }
+    return found;
+}
+
+void WorkStealingPool::execute(const Range& range)
+{
+    Batch& batch = *range.batch;
+    (*batch.fn)(range.begin, range.end);
+    std::lock_guard<std::mutex> lock(batch.mutex);
+    if (--batch.remaining == 0)
+    {
+        batch.condition.notify_all();
+    }
+}
+
+void WorkStealingPool::run(size_t queueIndex, WorkerOptions options)
+{
+    applyToCurrentThread(options);
+    for (;;)
+    {
+        Range range;
+        if (this->take(queueIndex, range))
+        {
+            this->execute(range);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->condition.wait(lock, [this]()
+        {
+            return this->stopRequested || this->queuedRanges > 0;
+        });
+        if (this->stopRequested)
+        {
+            return;
+        }
+    }
+}
+
+} // namespace vlStandIn
@@ -0,0 +1,133 @@
+#ifndef VL_STAND_IN_THREAD_POOL_H
+#define VL_STAND_IN_THREAD_POOL_H
+
+#include "Json.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vlStandIn
+{
+
+/*!
+ * \brief Concurrency settings of a worker.
+ *
+ * The settings are read from the \c VL_STAND_IN_* environment variables and
+ * from the options of \c vlNew_WorkerWithOptions.
+ */
+struct WorkerOptions
+{
+    /*!
+     * Number of threads, which process the data-parallel stages of a frame.
+     * The tracking thread is one of them. Zero uses all cores.
+     */
+    unsigned int threadCount = 1;
+    /*! CPUs the threads may run on. Zero doesn't restrict the threads. */
+    unsigned long long affinityMask = 0;
+    /*! -1: low, 0: unchanged, 1: high priority. */
+    int priority = 0;
+    /*!
+     * Whether the asynchronous worker acquires the next frames on a
+     * separate thread while the current frame is tracked.
+     */
+    bool pipelined = false;
+    /*! Maximum number of acquired frames waiting for the tracking. */
+    unsigned int pipelineDepth = 2;
+
+    void applyEnvironment();
+    bool applyJson(const JsonValue& options, std::string& error);
+
+    unsigned int getThreadCount() const;
+};
+
+/*!
+ * \brief Applies the affinity mask and the priority to the calling thread.
+ *
+ * Failures are logged, because a restricted process can't raise the
+ * priority of its threads.
+ */
+void applyToCurrentThread(const WorkerOptions& options);
+
+/*!
+ * \brief Pool for the data-parallel stages of the tracking.
+ *
+ * Every thread owns a queue of ranges. A thread takes the newest range of
+ * its own queue and steals the oldest ranges of the other queues, once its
+ * own queue is empty. The thread calling parallelFor works on its own
+ * queue as well, so a pool with one thread doesn't create any threads.
+ */
+class WorkStealingPool
+{
+public:
+    typedef std::function<void(size_t begin, size_t end)> RangeFunction;
+
+    explicit WorkStealingPool(const WorkerOptions& options);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /*!
+     * \brief Returns the number of threads including the calling thread.
+     */
+    unsigned int getThreadCount() const;
+
+    /*!
+     * \brief Calls \p fn for ranges of at most \p grainSize elements, which
+     * cover [0, count), and returns after all ranges were processed.
+     *
+     * \p fn must not throw.
+     */
+    void parallelFor(size_t count, size_t grainSize, const RangeFunction& fn);
+
+private:
+    struct Batch
+    {
+        const RangeFunction* fn = nullptr;
+        // Protects remaining. The last range notifies the caller while
+        // holding the mutex, so the batch can't be destroyed before.
+        std::mutex mutex;
+        std::condition_variable condition;
+        size_t remaining = 0;
+    };
+
+    struct Range
+    {
+        Batch* batch;
+        size_t begin;
+        size_t end;
+    };
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Range> ranges;
+    };
+
+    // Queue 0 belongs to the threads calling parallelFor
+    std::vector<std::unique_ptr<Queue> > queues;
+    std::vector<std::thread> threads;
+
+    // Protects queuedRanges and stopRequested. queuedRanges only wakes up
+    // the threads and can be negative for a moment, because the ranges are
+    // counted after they were queued.
+    std::mutex mutex;
+    std::condition_variable condition;
+    long long queuedRanges = 0;
+    bool stopRequested = false;
+
+    bool take(size_t queueIndex, Range& range);
+    void execute(const Range& range);
+    void run(size_t queueIndex, WorkerOptions options);
+};
+
+} // namespace vlStandIn
+
+#endif // VL_STAND_IN_THREAD_POOL_H
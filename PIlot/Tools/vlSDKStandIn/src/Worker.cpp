@@ -0,0 +1,1266 @@
+// Worker functions of vlSDK.h.
+
+#include "Application.h"
+#include "Log.h"
+#include "ThreadPool.h"
+
+#include <vlSDKStandIn.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+
+namespace vlStandIn
+{
+
+namespace
+{
+
+template<typename Callback>
+struct Listener
+{
+    Callback callback;
+    void* clientData;
+    std::string node;
+    std::string key;
+
+    bool matches(const Listener& other) const
+    {
+        return this->callback == other.callback &&
+            this->clientData == other.clientData &&
+            this->node == other.node && this->key == other.key;
+    }
+};
+
+typedef Listener<vlCallbackImageWrapper> ImageListener;
+typedef Listener<vlCallbackExtrinsicDataWrapper> ExtrinsicDataListener;
+typedef Listener<vlCallbackIntrinsicDataWrapper> IntrinsicDataListener;
+typedef Listener<vlCallbackZString> ZStringListener;
+
+struct Command
+{
+    std::string json;
+    std::vector<unsigned char> binary;
+    vlCallbackJsonString jsonCallback = nullptr;
+    vlCallbackJsonAndBinaryString binaryCallback = nullptr;
+    vlCallbackBool boolCallback = nullptr;
+    void* clientData = nullptr;
+};
+
+std::string makeError(const std::string& message)
+{
+    return "{\"message\":" + quoteJson(message) + ",\"issues\":[]}";
+}
+
+std::string toString(const char* str)
+{
+    return str != nullptr ? std::string(str) : std::string();
+}
+
+// Returns the camera pose for the default key, the pose of the tracked
+// object with the given name or an invalid pose for unknown keys.
+const vlExtrinsicDataWrapper_s& getExtrinsicData(const Frame& frame,
+    const std::string& key)
+{
+    static const vlExtrinsicDataWrapper_s invalidExtrinsicData;
+    if (key.empty())
+    {
+        return frame.extrinsicData;
+    }
+    for (size_t i = 0; i < frame.objects.size(); ++i)
+    {
+        if (frame.objects[i].name == key)
+        {
+            return frame.objects[i].extrinsicData;
+        }
+    }
+    return invalidExtrinsicData;
+}
+
+} // namespace
+
+} // namespace vlStandIn
+
+using namespace vlStandIn;
+
+struct vlWorker_s
+{
+    vlAbstractApplicationWrapper_s* aap = nullptr;
+    bool sync = false;
+
+    // Protects all members below
+    std::mutex mutex;
+    std::condition_variable commandCondition;
+    std::condition_variable eventCondition;
+    // Lock of vlWorker_Lock and vlWorker_Unlock
+    std::recursive_mutex userLock;
+    // Excludes Simulator::acquire from loading the simulator. Must be locked
+    // before mutex.
+    std::mutex acquisitionMutex;
+
+    std::thread thread;
+    bool threadRunning = false;
+    bool stopRequested = false;
+
+    // Pipelined mode: The acquisition thread fills acquiredFrames and the
+    // tracking thread empties it. Frames acquired for a previous tracker
+    // are discarded using the generation.
+    std::thread acquisitionThread;
+    std::condition_variable acquisitionCondition;
+    std::deque<std::shared_ptr<Frame> > acquiredFrames;
+    unsigned long long trackerGeneration = 0;
+
+    std::deque<Command> commands;
+    std::deque<std::function<void()> > callbacks;
+    std::deque<std::shared_ptr<Frame> > frames;
+    unsigned long long droppedFrames = 0;
+    std::shared_ptr<Frame> lastFrame;
+
+    std::vector<ImageListener> imageListeners;
+    std::vector<ExtrinsicDataListener> extrinsicDataListeners;
+    std::vector<IntrinsicDataListener> intrinsicDataListeners;
+    std::vector<ZStringListener> trackingStateListeners;
+    std::vector<ZStringListener> performanceInfoListeners;
+
+    bool trackerCreated = false;
+    bool running = false;
+    bool runOnce = false;
+    Simulator simulator;
+    AttributeMap attributes;
+
+    // Only used by the thread producing the frames
+    WorkerOptions options;
+    std::unique_ptr<WorkStealingPool> pool;
+
+    ~vlWorker_s()
+    {
+        this->stop();
+    }
+
+    bool start()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->sync || this->threadRunning)
+        {
+            return false;
+        }
+        this->stopRequested = false;
+        this->threadRunning = true;
+        this->thread = std::thread(&vlWorker_s::run, this);
+        if (this->options.pipelined)
+        {
+            this->acquisitionThread =
+                std::thread(&vlWorker_s::runAcquisition, this);
+        }
+        return true;
+    }
+
+    bool stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (!this->threadRunning)
+            {
+                return false;
+            }
+            this->stopRequested = true;
+        }
+        this->commandCondition.notify_all();
+        this->acquisitionCondition.notify_all();
+        this->thread.join();
+        if (this->acquisitionThread.joinable())
+        {
+            this->acquisitionThread.join();
+        }
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->threadRunning = false;
+        this->acquiredFrames.clear();
+        return true;
+    }
+
+    void pushCommand(Command& command)
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->commands.push_back(std::move(command));
+        }
+        this->commandCondition.notify_all();
+    }
+
+    // Executes the queued commands and schedules their callbacks for
+    // vlWorker_ProcessCallbacks. Must be called without holding the mutex.
+    void processCommands()
+    {
+        std::deque<Command> pending;
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            pending.swap(this->commands);
+        }
+        for (size_t i = 0; i < pending.size(); ++i)
+        {
+            Command& command = pending[i];
+            std::string error;
+            std::string result;
+            bool success = this->execute(command.json, result, error);
+
+            std::function<void()> callback;
+            if (command.binaryCallback != nullptr)
+            {
+                // Return the binary data together with the result
+                vlCallbackJsonAndBinaryString binaryCallback =
+                    command.binaryCallback;
+                void* clientData = command.clientData;
+                std::string description = success ?
+                    "{\"result\":" + result + "}" :
+                    "{\"error\":" + error + "}";
+                std::vector<unsigned char> binary;
+                binary.swap(command.binary);
+                callback = [binaryCallback, clientData, description, binary]()
+                {
+                    unsigned char* data = nullptr;
+                    if (!binary.empty())
+                    {
+                        data = static_cast<unsigned char*>(
+                            std::malloc(binary.size()));
+                        std::memcpy(data, binary.data(), binary.size());
+                    }
+                    binaryCallback(description.c_str(), data,
+                        static_cast<unsigned int>(binary.size()), clientData);
+                };
+            }
+            else if (command.boolCallback != nullptr)
+            {
+                vlCallbackBool boolCallback = command.boolCallback;
+                void* clientData = command.clientData;
+                callback = [boolCallback, clientData, success]()
+                {
+                    boolCallback(success, clientData);
+                };
+            }
+            else if (command.jsonCallback != nullptr)
+            {
+                vlCallbackJsonString jsonCallback = command.jsonCallback;
+                void* clientData = command.clientData;
+                callback = [jsonCallback, clientData, success, result, error]()
+                {
+                    jsonCallback(success ? nullptr : error.c_str(),
+                        success ? result.c_str() : nullptr, clientData);
+                };
+            }
+            if (callback)
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->callbacks.push_back(callback);
+            }
+        }
+    }
+
+    // Creates the next frame, if tracking is running. Returns false, if the
+    // sequence ended.
+    bool produceFrame()
+    {
+        double processingTime;
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (!this->trackerCreated || !(this->running || this->runOnce))
+            {
+                return true;
+            }
+            if (!this->simulator.hasNext())
+            {
+                return false;
+            }
+            this->runOnce = false;
+            processingTime = this->simulator.getConfig().processingTime;
+        }
+
+        // The simulated processing doesn't block the commands
+        std::shared_ptr<Frame> frame;
+        {
+            std::lock_guard<std::mutex> lock(this->acquisitionMutex);
+            frame = this->simulator.acquire(*this->pool);
+        }
+        this->simulator.track(*frame, processingTime, *this->pool);
+        this->publishFrame(frame);
+        return true;
+    }
+
+    // Tracks the oldest frame of the acquisition thread. Returns false, if
+    // no frame was acquired.
+    bool trackAcquiredFrame()
+    {
+        std::shared_ptr<Frame> frame;
+        double processingTime;
+        unsigned long long generation;
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (this->acquiredFrames.empty())
+            {
+                return false;
+            }
+            frame = this->acquiredFrames.front();
+            this->acquiredFrames.pop_front();
+            this->runOnce = false;
+            processingTime = this->simulator.getConfig().processingTime;
+            generation = this->trackerGeneration;
+        }
+        this->acquisitionCondition.notify_all();
+
+        this->simulator.track(*frame, processingTime, *this->pool);
+        {
+            // The tracking was paused or reset during the tracking
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (generation != this->trackerGeneration)
+            {
+                return true;
+            }
+        }
+        this->publishFrame(frame);
+        return true;
+    }
+
+    // Discards the frames of the acquisition thread, including a frame,
+    // which is currently acquired or tracked. Must be called with the mutex
+    // locked.
+    void discardAcquiredFrames()
+    {
+        ++this->trackerGeneration;
+        this->acquiredFrames.clear();
+    }
+
+    void publishFrame(const std::shared_ptr<Frame>& frame)
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->frames.push_back(frame);
+            unsigned int maxQueuedFrames =
+                std::max(1u, this->simulator.getConfig().maxQueuedFrames);
+            while (this->frames.size() > maxQueuedFrames)
+            {
+                // Like a camera, which delivers frames faster than they
+                // are consumed, the oldest frames get lost
+                this->frames.pop_front();
+                ++this->droppedFrames;
+            }
+            this->lastFrame = frame;
+        }
+        {
+            std::lock_guard<std::mutex> lock(this->aap->mutex);
+            this->aap->lastFrame = frame;
+        }
+        this->eventCondition.notify_all();
+    }
+
+    // Returns whether the acquisition thread should acquire a frame. Must
+    // be called with the mutex locked.
+    bool needsAcquisition()
+    {
+        if (!this->trackerCreated || !this->simulator.hasNext())
+        {
+            return false;
+        }
+        if (this->running)
+        {
+            // Bounded queue. A slow tracking slows down the acquisition.
+            return this->acquiredFrames.size() <
+                std::max(1u, this->options.pipelineDepth);
+        }
+        return this->runOnce && this->acquiredFrames.empty();
+    }
+
+    // Acquisition stage of the pipelined mode. It keeps the frame rate,
+    // while the tracking thread estimates the poses of the previous frames.
+    void runAcquisition()
+    {
+        applyToCurrentThread(this->options);
+        double nextFrameTime = getTime();
+        for (;;)
+        {
+            double fps;
+            unsigned long long generation;
+            {
+                std::unique_lock<std::mutex> lock(this->mutex);
+                for (;;)
+                {
+                    if (this->stopRequested)
+                    {
+                        return;
+                    }
+                    double now = getTime();
+                    if (!this->needsAcquisition())
+                    {
+                        this->acquisitionCondition.wait_for(lock,
+                            std::chrono::duration<double>(0.1));
+                    }
+                    else if (now < nextFrameTime)
+                    {
+                        this->acquisitionCondition.wait_for(lock,
+                            std::chrono::duration<double>(
+                                nextFrameTime - now));
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+                fps = this->simulator.getConfig().fps;
+                generation = this->trackerGeneration;
+            }
+
+            std::shared_ptr<Frame> frame;
+            {
+                std::lock_guard<std::mutex> lock(this->acquisitionMutex);
+                frame = this->simulator.acquire(*this->pool);
+            }
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                if (generation == this->trackerGeneration)
+                {
+                    this->acquiredFrames.push_back(frame);
+                }
+            }
+            this->commandCondition.notify_all();
+
+            // Keep the frame rate, but don't catch up with frames, which
+            // were missed while the queue was full
+            nextFrameTime = (fps > 0.0) ?
+                std::max(nextFrameTime + 1.0 / fps, getTime()) : getTime();
+        }
+    }
+
+    void run()
+    {
+        applyToCurrentThread(this->options);
+        double nextFrameTime = getTime();
+        for (;;)
+        {
+            this->processCommands();
+            if (this->options.pipelined)
+            {
+                // The commands might have started the tracking
+                this->acquisitionCondition.notify_all();
+            }
+
+            double fps;
+            bool active;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                if (this->stopRequested)
+                {
+                    break;
+                }
+                fps = this->simulator.getConfig().fps;
+                active = !this->options.pipelined && this->trackerCreated &&
+                    (this->running || this->runOnce) && this->simulator.hasNext();
+            }
+
+            double now = getTime();
+            if (this->options.pipelined)
+            {
+                // The acquisition thread keeps the frame rate
+                if (this->trackAcquiredFrame())
+                {
+                    continue;
+                }
+            }
+            else if (active && now >= nextFrameTime)
+            {
+                this->produceFrame();
+                // Keep the frame rate, but don't catch up with frames,
+                // which were missed during a long processing time
+                nextFrameTime = (fps > 0.0) ?
+                    std::max(nextFrameTime + 1.0 / fps, getTime()) :
+                    getTime();
+                continue;
+            }
+
+            // Wait for the next frame or the next command
+            std::unique_lock<std::mutex> lock(this->mutex);
+            if (this->commands.empty() && this->acquiredFrames.empty() &&
+                !this->stopRequested)
+            {
+                double timeout = active ? nextFrameTime - now : 0.1;
+                this->commandCondition.wait_for(lock,
+                    std::chrono::duration<double>(timeout));
+            }
+        }
+    }
+
+    bool readConfig(const JsonValue& param, std::string& config,
+        std::string& error)
+    {
+        if (param.type == JsonValue::Type::String)
+        {
+            std::string path = param.string;
+            if (path.compare(0, 7, "file://") == 0)
+            {
+                path = path.substr(7);
+            }
+            std::ifstream file(path.c_str(), std::ios::binary);
+            if (!file)
+            {
+                // Schemes like "streaming-assets-dir:" can't be resolved
+                // here. The settings from the environment are used instead.
+                log(VL_LOG_WARNING, "[vlSDKStandIn] Could not read '" +
+                    param.string + "', using the default configuration");
+                config = "{}";
+                return true;
+            }
+            std::ostringstream stream;
+            stream << file.rdbuf();
+            config = stream.str();
+            return true;
+        }
+        const JsonValue* str = param.find("str");
+        if (str == nullptr || str->type != JsonValue::Type::String)
+        {
+            error = makeError("Missing tracking configuration");
+            return false;
+        }
+        config = str->string;
+        return true;
+    }
+
+    bool createTracker(const JsonValue& param, std::string& error)
+    {
+        std::string text;
+        if (!this->readConfig(param, text, error))
+        {
+            return false;
+        }
+        JsonValue trackingConfig;
+        if (!parseJson(text, trackingConfig))
+        {
+            error = makeError("Could not parse the tracking configuration");
+            return false;
+        }
+
+        SimulatorConfig config;
+        config.applyEnvironment();
+        const JsonValue* standIn = trackingConfig.find("standIn");
+        if (standIn != nullptr)
+        {
+            config.applyJson(*standIn);
+        }
+        std::string trackerType = "modelTracker";
+        const JsonValue* tracker = trackingConfig.find("tracker");
+        if (tracker != nullptr)
+        {
+            trackerType = tracker->getString("type", trackerType);
+        }
+
+        std::string loadError;
+        std::lock_guard<std::mutex> acquisitionLock(this->acquisitionMutex);
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (!this->simulator.load(config, loadError))
+        {
+            error = makeError(loadError);
+            return false;
+        }
+        this->discardAcquiredFrames();
+        this->trackerCreated = true;
+        this->running = false;
+        this->runOnce = false;
+        this->frames.clear();
+        this->lastFrame.reset();
+        std::lock_guard<std::mutex> aapLock(this->aap->mutex);
+        this->aap->trackerType = trackerType;
+        return true;
+    }
+
+    bool execute(const std::string& json, std::string& result,
+        std::string& error)
+    {
+        JsonValue command;
+        if (!parseJson(json, command) ||
+            command.type != JsonValue::Type::Object)
+        {
+            error = makeError("Invalid command JSON");
+            return false;
+        }
+        std::string name = command.getString("name", "");
+        JsonValue param;
+        const JsonValue* paramPtr = command.find("param");
+        if (paramPtr != nullptr)
+        {
+            param = *paramPtr;
+        }
+        result = "null";
+
+        if (name == "createTracker" || name == "createTrackerFromString")
+        {
+            return this->createTracker(param, error);
+        }
+
+        // Resetting the simulator must not overlap with an acquisition
+        bool reset = (name == "resetTracking" || name == "resetSoft" ||
+            name == "resetHard");
+        std::unique_lock<std::mutex> acquisitionLock(this->acquisitionMutex,
+            std::defer_lock);
+        if (reset)
+        {
+            acquisitionLock.lock();
+        }
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (!this->trackerCreated)
+        {
+            error = makeError("No tracker was created");
+            return false;
+        }
+        if (name == "runTracking")
+        {
+            this->running = true;
+        }
+        else if (name == "pauseTracking")
+        {
+            // Frames acquired before the pause must not be published
+            this->running = false;
+            this->discardAcquiredFrames();
+        }
+        else if (name == "runTrackingOnce")
+        {
+            this->runOnce = true;
+        }
+        else if (reset)
+        {
+            // Frames acquired before the reset belong to the old tracking
+            this->simulator.reset();
+            this->discardAcquiredFrames();
+        }
+        else if (name == "setTargetFPS")
+        {
+            if (param.type != JsonValue::Type::Number || param.number <= 0.0)
+            {
+                error = makeError("Invalid frame rate");
+                return false;
+            }
+            this->simulator.setFps(param.number);
+        }
+        else if (name == "getAttribute")
+        {
+            AttributeMap::const_iterator it =
+                this->attributes.find(param.string);
+            if (param.type != JsonValue::Type::String ||
+                it == this->attributes.end())
+            {
+                error = makeError("Unknown attribute");
+                return false;
+            }
+            result = "{\"value\":" + quoteJson(it->second) + "}";
+        }
+        else if (name == "setAttribute")
+        {
+            std::string attribute = param.getString("att", "");
+            if (attribute.empty())
+            {
+                error = makeError("Missing attribute name");
+                return false;
+            }
+            const JsonValue* value = param.find("val");
+            this->attributes[attribute] = value == nullptr ? "" :
+                (value->type == JsonValue::Type::String ? value->string :
+                    toJson(*value));
+        }
+        // All other commands of the pipelines are accepted without effect
+        return true;
+    }
+
+    bool pollEvents()
+    {
+        std::deque<std::shared_ptr<Frame> > pending;
+        std::vector<ImageListener> imageListeners;
+        std::vector<ExtrinsicDataListener> extrinsicDataListeners;
+        std::vector<IntrinsicDataListener> intrinsicDataListeners;
+        std::vector<ZStringListener> trackingStateListeners;
+        std::vector<ZStringListener> performanceInfoListeners;
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            pending.swap(this->frames);
+            imageListeners = this->imageListeners;
+            extrinsicDataListeners = this->extrinsicDataListeners;
+            intrinsicDataListeners = this->intrinsicDataListeners;
+            trackingStateListeners = this->trackingStateListeners;
+            performanceInfoListeners = this->performanceInfoListeners;
+        }
+
+        // Same order as the VisionLib: image, extrinsic data, intrinsic
+        // data, tracking state and performance info
+        for (size_t f = 0; f < pending.size(); ++f)
+        {
+            Frame& frame = *pending[f];
+            for (size_t i = 0; i < imageListeners.size(); ++i)
+            {
+                imageListeners[i].callback(&frame.image,
+                    imageListeners[i].clientData);
+            }
+            for (size_t i = 0; i < extrinsicDataListeners.size(); ++i)
+            {
+                vlExtrinsicDataWrapper_s extrinsicData =
+                    getExtrinsicData(frame, extrinsicDataListeners[i].key);
+                extrinsicDataListeners[i].callback(&extrinsicData,
+                    extrinsicDataListeners[i].clientData);
+            }
+            for (size_t i = 0; i < intrinsicDataListeners.size(); ++i)
+            {
+                vlIntrinsicDataWrapper_s intrinsicData = frame.intrinsicData;
+                intrinsicDataListeners[i].callback(&intrinsicData,
+                    intrinsicDataListeners[i].clientData);
+            }
+            for (size_t i = 0; i < trackingStateListeners.size(); ++i)
+            {
+                trackingStateListeners[i].callback(frame.trackingState.c_str(),
+                    trackingStateListeners[i].clientData);
+            }
+            for (size_t i = 0; i < performanceInfoListeners.size(); ++i)
+            {
+                performanceInfoListeners[i].callback(
+                    frame.performanceInfo.c_str(),
+                    performanceInfoListeners[i].clientData);
+            }
+        }
+        return true;
+    }
+};
+
+namespace
+{
+
+template<typename Callback>
+bool addListener(vlWorker_t* worker,
+    std::vector<Listener<Callback> > vlWorker_s::*listeners,
+    Callback callback, void* clientData, const char node[] = nullptr,
+    const char key[] = nullptr)
+{
+    if (worker == nullptr || callback == nullptr)
+    {
+        return false;
+    }
+    Listener<Callback> listener = {callback, clientData, toString(node),
+        toString(key)};
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    std::vector<Listener<Callback> >& list = worker->*listeners;
+    for (size_t i = 0; i < list.size(); ++i)
+    {
+        if (list[i].matches(listener))
+        {
+            return false;
+        }
+    }
+    list.push_back(listener);
+    return true;
+}
+
+template<typename Callback>
+bool removeListener(vlWorker_t* worker,
+    std::vector<Listener<Callback> > vlWorker_s::*listeners,
+    Callback callback, void* clientData, const char node[] = nullptr,
+    const char key[] = nullptr)
+{
+    if (worker == nullptr)
+    {
+        return false;
+    }
+    Listener<Callback> listener = {callback, clientData, toString(node),
+        toString(key)};
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    std::vector<Listener<Callback> >& list = worker->*listeners;
+    for (size_t i = 0; i < list.size(); ++i)
+    {
+        if (list[i].matches(listener))
+        {
+            list.erase(list.begin() + i);
+            return true;
+        }
+    }
+    return false;
+}
+
+vlWorker_t* newWorker(vlAbstractApplicationWrapper_t* aap, bool sync,
+    const char optionsJson[] = nullptr)
+{
+    if (aap == nullptr)
+    {
+        return nullptr;
+    }
+    WorkerOptions options;
+    options.applyEnvironment();
+    if (optionsJson != nullptr && optionsJson[0] != '\0')
+    {
+        JsonValue value;
+        std::string error;
+        if (!parseJson(optionsJson, value))
+        {
+            log(VL_LOG_WARNING,
+                "[vlSDKStandIn] Could not parse the worker options");
+            return nullptr;
+        }
+        if (!options.applyJson(value, error))
+        {
+            log(VL_LOG_WARNING, "[vlSDKStandIn] " + error);
+            return nullptr;
+        }
+    }
+    vlWorker_t* worker = new vlWorker_s();
+    worker->aap = aap;
+    worker->sync = sync;
+    worker->options = options;
+    worker->pool.reset(new WorkStealingPool(options));
+    SimulatorConfig config;
+    config.applyEnvironment();
+    std::string error;
+    worker->simulator.load(config, error);
+    return worker;
+}
+
+vlImageWrapper_t* getImageSync(vlWorker_t* worker)
+{
+    if (worker == nullptr)
+    {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    return worker->lastFrame ?
+        new vlImageWrapper_s(worker->lastFrame->image) : nullptr;
+}
+
+} // namespace
+
+extern "C"
+{
+
+vlWorker_t* VL_CALLINGCONVENTION vlNew_Worker(
+    vlAbstractApplicationWrapper_t* aap)
+{
+    return newWorker(aap, false);
+}
+
+vlWorker_t* VL_CALLINGCONVENTION vlNew_SyncWorker(
+    vlAbstractApplicationWrapper_t* aap)
+{
+    return newWorker(aap, true);
+}
+
+vlWorker_t* VL_CALLINGCONVENTION vlNew_WorkerWithOptions(
+    vlAbstractApplicationWrapper_t* aap, const char optionsJson[])
+{
+    return newWorker(aap, false, optionsJson);
+}
+
+vlWorker_t* VL_CALLINGCONVENTION vlNew_SyncWorkerWithOptions(
+    vlAbstractApplicationWrapper_t* aap, const char optionsJson[])
+{
+    return newWorker(aap, true, optionsJson);
+}
+
+void VL_CALLINGCONVENTION vlDelete_Worker(vlWorker_t* worker)
+{
+    delete worker;
+}
+
+bool VL_CALLINGCONVENTION vlWorker_Start(vlWorker_t* worker)
+{
+    return worker != nullptr && worker->start();
+}
+
+bool VL_CALLINGCONVENTION vlWorker_Stop(vlWorker_t* worker)
+{
+    return worker != nullptr && worker->stop();
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RunOnceSync(vlWorker_t* worker)
+{
+    if (worker == nullptr || !worker->sync)
+    {
+        return false;
+    }
+    worker->processCommands();
+    return worker->produceFrame();
+}
+
+bool VL_CALLINGCONVENTION vlWorker_ProcessJsonCommandSync(
+    vlWorker_t* worker, const char jsonString[],
+    vlCallbackJsonString callback, void* clientData)
+{
+    if (worker == nullptr || jsonString == nullptr || !worker->sync)
+    {
+        return false;
+    }
+    std::string result;
+    std::string error;
+    bool success = worker->execute(jsonString, result, error);
+    if (callback != nullptr)
+    {
+        callback(success ? nullptr : error.c_str(),
+            success ? result.c_str() : nullptr, clientData);
+    }
+    return true;
+}
+
+vlImageWrapper_t* VL_CALLINGCONVENTION vlWorker_GetImageSync(
+    vlWorker_t* worker)
+{
+    return getImageSync(worker);
+}
+
+vlImageWrapper_t* VL_CALLINGCONVENTION vlWorker_GetImageByNameSync(
+    vlWorker_t* worker, const char* image_name)
+{
+    if (image_name == nullptr || std::strcmp(image_name, imageKey) != 0)
+    {
+        return nullptr;
+    }
+    return getImageSync(worker);
+}
+
+vlImageWrapper_t* VL_CALLINGCONVENTION vlWorker_GetImageFromNodeSync(
+    vlWorker_t* worker, const char node[], const char key[])
+{
+    (void)node;
+    return vlWorker_GetImageByNameSync(worker, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_IsRunning(vlWorker_t* worker)
+{
+    if (worker == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    return worker->threadRunning;
+}
+
+bool VL_CALLINGCONVENTION vlWorker_PushCommand(vlWorker_t* worker,
+    const char name[], const char parameter[], vlCallbackBool callback,
+    void* clientData)
+{
+    if (worker == nullptr || name == nullptr)
+    {
+        return false;
+    }
+
+    // Legacy commands only have a string parameter and report success
+    Command command;
+    command.json = "{\"name\":" + quoteJson(name) + ",\"param\":" +
+        quoteJson(toString(parameter)) + "}";
+    command.boolCallback = callback;
+    command.clientData = clientData;
+    worker->pushCommand(command);
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlWorker_PushJsonCommand(vlWorker_t* worker,
+    const char jsonString[], vlCallbackJsonString callback, void* clientData)
+{
+    if (worker == nullptr || jsonString == nullptr)
+    {
+        return false;
+    }
+    Command command;
+    command.json = jsonString;
+    command.jsonCallback = callback;
+    command.clientData = clientData;
+    worker->pushCommand(command);
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlWorker_PushJsonAndBinaryCommand(
+    vlWorker_t* worker, const char jsonString[], const unsigned char data[],
+    unsigned int size, vlCallbackJsonAndBinaryString callback,
+    void* clientData)
+{
+    if (worker == nullptr || jsonString == nullptr ||
+        (data == nullptr && size > 0))
+    {
+        return false;
+    }
+    Command command;
+    command.json = jsonString;
+    if (size > 0)
+    {
+        command.binary.assign(data, data + size);
+    }
+    command.binaryCallback = callback;
+    command.clientData = clientData;
+    worker->pushCommand(command);
+    return true;
+}
+
+void VL_CALLINGCONVENTION vlReleaseBinaryBuffer(const unsigned char data[])
+{
+    std::free(const_cast<unsigned char*>(data));
+}
+
+bool VL_CALLINGCONVENTION vlWorker_ProcessCallbacks(vlWorker_t* worker)
+{
+    if (worker == nullptr)
+    {
+        return false;
+    }
+    std::deque<std::function<void()> > callbacks;
+    {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        callbacks.swap(worker->callbacks);
+    }
+    for (size_t i = 0; i < callbacks.size(); ++i)
+    {
+        callbacks[i]();
+    }
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlWorker_AddImageListener(vlWorker_t* worker,
+    vlCallbackImageWrapper listener, void* clientData)
+{
+    return addListener(worker, &vlWorker_s::imageListeners, listener,
+        clientData);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemoveImageListener(vlWorker_t* worker,
+    vlCallbackImageWrapper listener, void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::imageListeners, listener,
+        clientData);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_AddExtrinsicDataListener(
+    vlWorker_t* worker, vlCallbackExtrinsicDataWrapper listener,
+    void* clientData)
+{
+    return addListener(worker, &vlWorker_s::extrinsicDataListeners, listener,
+        clientData);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemoveExtrinsicDataListener(
+    vlWorker_t* worker, vlCallbackExtrinsicDataWrapper listener,
+    void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::extrinsicDataListeners,
+        listener, clientData);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_AddIntrinsicDataListener(
+    vlWorker_t* worker, vlCallbackIntrinsicDataWrapper listener,
+    void* clientData)
+{
+    return addListener(worker, &vlWorker_s::intrinsicDataListeners, listener,
+        clientData);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemoveIntrinsicDataListener(
+    vlWorker_t* worker, vlCallbackIntrinsicDataWrapper listener,
+    void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::intrinsicDataListeners,
+        listener, clientData);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_AddTrackingStateListener(
+    vlWorker_t* worker, vlCallbackZString listener, void* clientData)
+{
+    return addListener(worker, &vlWorker_s::trackingStateListeners, listener,
+        clientData);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemoveTrackingStateListener(
+    vlWorker_t* worker, vlCallbackZString listener, void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::trackingStateListeners,
+        listener, clientData);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_AddPerformanceInfoListener(
+    vlWorker_t* worker, vlCallbackZString listener, void* clientData)
+{
+    return addListener(worker, &vlWorker_s::performanceInfoListeners,
+        listener, clientData);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemovePerformanceInfoListener(
+    vlWorker_t* worker, vlCallbackZString listener, void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::performanceInfoListeners,
+        listener, clientData);
+}
+
+// The simulator has a single image and intrinsic data source. Named and
+// node listeners therefore receive the same data as the default listeners.
+// Extrinsic data listeners with the name of a tracked object as key receive
+// the pose of this object. Other keys receive an invalid pose.
+
+bool VL_CALLINGCONVENTION vlWorker_AddNamedImageListener(vlWorker_t* worker,
+    const char key[], vlCallbackImageWrapper listener, void* clientData)
+{
+    return addListener(worker, &vlWorker_s::imageListeners, listener,
+        clientData, nullptr, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemoveNamedImageListener(
+    vlWorker_t* worker, const char key[], vlCallbackImageWrapper listener,
+    void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::imageListeners, listener,
+        clientData, nullptr, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_AddNamedExtrinsicDataListener(
+    vlWorker_t* worker, const char key[],
+    vlCallbackExtrinsicDataWrapper listener, void* clientData)
+{
+    return addListener(worker, &vlWorker_s::extrinsicDataListeners, listener,
+        clientData, nullptr, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemoveNamedExtrinsicDataListener(
+    vlWorker_t* worker, const char key[],
+    vlCallbackExtrinsicDataWrapper listener, void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::extrinsicDataListeners,
+        listener, clientData, nullptr, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_AddNamedIntrinsicDataListener(
+    vlWorker_t* worker, const char key[],
+    vlCallbackIntrinsicDataWrapper listener, void* clientData)
+{
+    return addListener(worker, &vlWorker_s::intrinsicDataListeners, listener,
+        clientData, nullptr, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemoveNamedIntrinsicDataListener(
+    vlWorker_t* worker, const char key[],
+    vlCallbackIntrinsicDataWrapper listener, void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::intrinsicDataListeners,
+        listener, clientData, nullptr, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_AddNodeDataImageListener(
+    vlWorker_t* worker, const char node[], const char key[],
+    vlCallbackImageWrapper listener, void* clientData)
+{
+    return addListener(worker, &vlWorker_s::imageListeners, listener,
+        clientData, node, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemoveNodeDataImageListener(
+    vlWorker_t* worker, const char node[], const char key[],
+    vlCallbackImageWrapper listener, void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::imageListeners, listener,
+        clientData, node, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_AddNodeDataExtrinsicDataListener(
+    vlWorker_t* worker, const char node[], const char key[],
+    vlCallbackExtrinsicDataWrapper listener, void* clientData)
+{
+    return addListener(worker, &vlWorker_s::extrinsicDataListeners, listener,
+        clientData, node, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemoveNodeDataExtrinsicDataListener(
+    vlWorker_t* worker, const char node[], const char key[],
+    vlCallbackExtrinsicDataWrapper listener, void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::extrinsicDataListeners,
+        listener, clientData, node, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_AddNodeDataIntrinsicDataListener(
+    vlWorker_t* worker, const char node[], const char key[],
+    vlCallbackIntrinsicDataWrapper listener, void* clientData)
+{
+    return addListener(worker, &vlWorker_s::intrinsicDataListeners, listener,
+        clientData, node, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemoveNodeDataIntrinsicDataListener(
+    vlWorker_t* worker, const char node[], const char key[],
+    vlCallbackIntrinsicDataWrapper listener, void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::intrinsicDataListeners,
+        listener, clientData, node, key);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_AddNodeTrackingStateListener(
+    vlWorker_t* worker, const char node[], vlCallbackZString listener,
+    void* clientData)
+{
+    return addListener(worker, &vlWorker_s::trackingStateListeners, listener,
+        clientData, node);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_RemoveNodeTrackingStateListener(
+    vlWorker_t* worker, const char node[], vlCallbackZString listener,
+    void* clientData)
+{
+    return removeListener(worker, &vlWorker_s::trackingStateListeners,
+        listener, clientData, node);
+}
+
+bool VL_CALLINGCONVENTION vlWorker_ClearListeners(vlWorker_t* worker)
+{
+    if (worker == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    worker->imageListeners.clear();
+    worker->extrinsicDataListeners.clear();
+    worker->intrinsicDataListeners.clear();
+    worker->trackingStateListeners.clear();
+    worker->performanceInfoListeners.clear();
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlWorker_PollEvents(vlWorker_t* worker)
+{
+    return worker != nullptr && worker->pollEvents();
+}
+
+bool VL_CALLINGCONVENTION vlWorker_WaitEvents(vlWorker_t* worker,
+    unsigned int timeout)
+{
+    if (worker == nullptr)
+    {
+        return false;
+    }
+    {
+        std::unique_lock<std::mutex> lock(worker->mutex);
+        if (!worker->eventCondition.wait_for(lock,
+                std::chrono::milliseconds(timeout),
+                [worker]() { return !worker->frames.empty(); }))
+        {
+            return false;
+        }
+    }
+    return worker->pollEvents();
+}
+
+bool VL_CALLINGCONVENTION vlWorker_Lock(vlWorker_t* worker)
+{
+    if (worker == nullptr)
+    {
+        return false;
+    }
+    worker->userLock.lock();
+    return true;
+}
+
+bool VL_CALLINGCONVENTION vlWorker_Unlock(vlWorker_t* worker)
+{
+    if (worker == nullptr)
+    {
+        return false;
+    }
+    worker->userLock.unlock();
+    return true;
+}
+
+} // extern "C"